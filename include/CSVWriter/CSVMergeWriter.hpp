@@ -0,0 +1,304 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CSVWriter.hpp"
+
+// Multi-producer front end for one CSV file. Every thread logs complete rows
+// into its own single-producer ring, so producers never contend with each
+// other; a merger thread interleaves the rings into the file in timestamp
+// order with a k-way merge.
+//
+//   CSVMergeWriter log("run.csv", {"x", "y"});
+//   // on any thread:
+//   log.producer() << x << y;
+//   log.producer().endRow();
+//
+// Rows are stamped with std::chrono::steady_clock when they are ended, and
+// the stamp (in ns) is written as the first column. A row is written once
+// no producer can still end a row with an earlier stamp: a producer with
+// queued rows bounds its future stamps by its oldest queued row, an idle
+// one and any producer registered later by the current time. A producer
+// that is ending a row raises its `writing` flag before taking the stamp,
+// so the merger waits for it instead of assuming the current time.
+//
+// A producer whose ring is full waits for the merger instead of dropping
+// rows. The destructor writes everything still queued, so all producers
+// must have stopped logging by then.
+class CSVMergeWriter
+{
+   public:
+    class Producer
+    {
+       public:
+        Producer(const std::string& seperator, size_t capacity)
+            : row(seperator), entries(capacity), mask(capacity - 1)
+        {
+        }
+
+        template <typename T>
+        Producer& add(T value)
+        {
+            this->row.add(value);
+            return *this;
+        }
+
+        template <typename T>
+        Producer& operator<<(const T& t)
+        {
+            return this->add(t);
+        }
+
+        // Stamps the current row and hands it to the merger
+        void endRow()
+        {
+            std::string text = this->row.toString();
+            this->row.clearRow();
+
+            this->writing.store(true);
+            int64_t timestamp = now();
+            size_t  tail      = this->tail.load(std::memory_order_relaxed);
+            while (tail - this->head.load(std::memory_order_acquire) ==
+                   this->entries.size())
+            {
+                std::this_thread::yield();
+            }
+
+            Entry& entry       = this->entries[tail & this->mask];
+            entry.timestamp_ns = timestamp;
+            entry.text         = std::move(text);
+            this->tail.store(tail + 1, std::memory_order_release);
+            this->writing.store(false, std::memory_order_release);
+        }
+
+       private:
+        friend class CSVMergeWriter;
+
+        // Exposes the row reset that CSVWriter keeps protected
+        class RowWriter : public CSVWriter
+        {
+           public:
+            RowWriter(const std::string& seperator) : CSVWriter(seperator) {}
+
+            void clearRow()
+            {
+                this->resetContent();
+                this->valueCount = 0;
+            }
+        };
+
+        struct Entry
+        {
+            int64_t     timestamp_ns = 0;
+            std::string text;
+        };
+
+        RowWriter          row;
+        std::vector<Entry> entries;
+        size_t             mask;
+
+        alignas(64) std::atomic<size_t> tail{0};  // Written by the producer
+        alignas(64) std::atomic<bool> writing{false};
+        alignas(64) std::atomic<size_t> head{0};  // Written by the merger
+    };
+
+    CSVMergeWriter(const std::string&              filename,
+                   const std::vector<std::string>& columns         = {},
+                   const std::string&              seperator       = ";",
+                   size_t                          rowsPerProducer = 4096)
+        : seperator(seperator),
+          capacity(roundUpToPowerOfTwo(rowsPerProducer)),
+          id(nextId().fetch_add(1))
+    {
+        this->file.open(filename.c_str(), std::ios::out | std::ios::trunc);
+        if (!this->file.is_open())
+        {
+            throw std::runtime_error("Cannot open " + filename +
+                                     " for writing.");
+        }
+
+        if (!columns.empty())
+        {
+            CSVWriter header(seperator);
+            header << "timestamp_ns";
+            for (const auto& column : columns)
+            {
+                header << column;
+            }
+            this->file << header << '\n';
+        }
+
+        this->merger = std::thread(&CSVMergeWriter::run, this);
+    }
+
+    ~CSVMergeWriter()
+    {
+        this->stopping.store(true);
+        this->merger.join();
+        this->file.close();
+    }
+
+    CSVMergeWriter(const CSVMergeWriter&)            = delete;
+    CSVMergeWriter& operator=(const CSVMergeWriter&) = delete;
+
+    // The calling thread's producer, created on its first call. It must
+    // only be used by that thread.
+    Producer& producer()
+    {
+        thread_local std::unordered_map<uint64_t, Producer*> cache;
+
+        auto found = cache.find(this->id);
+        if (found != cache.end())
+        {
+            return *found->second;
+        }
+
+        std::lock_guard<std::mutex> lock(this->producersMutex);
+        this->producers.push_back(
+            std::make_unique<Producer>(this->seperator, this->capacity));
+        Producer* created = this->producers.back().get();
+        cache[this->id]   = created;
+        return *created;
+    }
+
+   private:
+    using Item = std::pair<int64_t, size_t>;  // Oldest stamp, producer
+    using Heap =
+        std::priority_queue<Item, std::vector<Item>, std::greater<Item>>;
+
+    std::string                            seperator;
+    size_t                                 capacity;
+    uint64_t                               id;
+    std::ofstream                          file;
+    std::mutex                             producersMutex;
+    std::vector<std::unique_ptr<Producer>> producers;
+    std::atomic<bool>                      stopping{false};
+    std::thread                            merger;
+
+    static int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static std::atomic<uint64_t>& nextId()
+    {
+        static std::atomic<uint64_t> id{0};
+        return id;
+    }
+
+    static size_t roundUpToPowerOfTwo(size_t value)
+    {
+        size_t result = 2;
+        while (result < value)
+        {
+            result *= 2;
+        }
+        return result;
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            bool stop = this->stopping.load();
+            if (this->merge(stop) > 0)
+            {
+                this->file.flush();
+            }
+            else if (!stop)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (stop)
+            {
+                return;
+            }
+        }
+    }
+
+    // Either queues the producer's oldest row or lowers `limit` to the
+    // earliest stamp it can still produce.
+    static void track(const Producer& producer,
+                      size_t          index,
+                      bool            drain,
+                      Heap&           heap,
+                      int64_t&        limit)
+    {
+        int64_t bound   = now();
+        bool    writing = producer.writing.load();
+        size_t  head    = producer.head.load(std::memory_order_relaxed);
+        if (producer.tail.load(std::memory_order_acquire) != head)
+        {
+            heap.push(
+                {producer.entries[head & producer.mask].timestamp_ns, index});
+        }
+        else if (writing && !drain)
+        {
+            limit = std::numeric_limits<int64_t>::min();
+        }
+        else if (!drain)
+        {
+            limit = std::min(limit, bound);
+        }
+    }
+
+    // Writes every row that is safe to write; with `drain`, every queued
+    // row. Returns the number of rows written.
+    size_t merge(bool drain)
+    {
+        // A producer that registers after this copy can only stamp rows
+        // after the lock is released, so `now()` taken under the lock bounds
+        // every row this pass does not know about.
+        std::vector<Producer*> current;
+        int64_t                limit = std::numeric_limits<int64_t>::max();
+        {
+            std::lock_guard<std::mutex> lock(this->producersMutex);
+            for (const auto& producer : this->producers)
+            {
+                current.push_back(producer.get());
+            }
+            if (!drain)
+            {
+                limit = now();
+            }
+        }
+
+        Heap heap;
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            track(*current[i], i, drain, heap, limit);
+        }
+
+        size_t written = 0;
+        while (!heap.empty() && heap.top().first <= limit)
+        {
+            size_t index = heap.top().second;
+            heap.pop();
+
+            Producer& producer = *current[index];
+            size_t    head = producer.head.load(std::memory_order_relaxed);
+            const auto& entry = producer.entries[head & producer.mask];
+            this->file << entry.timestamp_ns << this->seperator << entry.text
+                       << '\n';
+            producer.head.store(head + 1, std::memory_order_release);
+            ++written;
+
+            track(producer, index, drain, heap, limit);
+        }
+        return written;
+    }
+};
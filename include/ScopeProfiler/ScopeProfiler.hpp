@@ -1,13 +1,33 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <new>
 #include <set>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
+#if defined(__unix__)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 class ScopeProfiler
 {
    public:
@@ -19,9 +39,111 @@ class ScopeProfiler
         int         us;
     };
 
+    // Live per-tag statistics in POSIX shared memory, read by
+    // `utils_profview`. Every (thread, tag) pair owns one slot, so a slot
+    // has a single writer. The writer brackets each update with its
+    // sequence counter (odd while writing) and readers retry when the
+    // counter moved, so publishing never waits on a reader.
+    static constexpr const char *defaultSharedName = "/utils_scope_profiler";
+    static constexpr uint64_t    sharedMagic       = 0x31464f5250504353;
+    static constexpr uint32_t    sharedVersion     = 1;
+    static constexpr size_t      sharedTagSize     = 128;
+
+    struct alignas(64) SharedSlot
+    {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> ready;  // `thread` and `tag` are valid
+        uint64_t              thread;
+        char                  tag[sharedTagSize];
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> total_us;
+        std::atomic<int64_t>  min_us;
+        std::atomic<int64_t>  max_us;
+        std::atomic<int64_t>  last_us;
+    };
+
+    struct alignas(64) SharedHeader
+    {
+        std::atomic<uint64_t> magic;  // Stored last, once the rest is valid
+        uint32_t              version;
+        uint32_t              capacity;
+        std::atomic<uint32_t> claimed;  // Exceeds capacity once slots ran out
+        int32_t               pid;
+
+        SharedSlot *slots()
+        {
+            return reinterpret_cast<SharedSlot *>(this + 1);
+        }
+        SharedSlot const *slots() const
+        {
+            return reinterpret_cast<SharedSlot const *>(this + 1);
+        }
+    };
+
+    struct SharedStatistic
+    {
+        uint64_t    thread;
+        std::string tag;
+        uint64_t    count;
+        uint64_t    total_us;
+        int64_t     min_us;
+        int64_t     max_us;
+        int64_t     last_us;
+    };
+
+    static size_t sharedSize(uint32_t capacity)
+    {
+        return sizeof(SharedHeader) + capacity * sizeof(SharedSlot);
+    }
+
+#if defined(__unix__)
+    // Creates the segment `name` with room for `capacity` (thread, tag)
+    // pairs and starts publishing into it. Pairs beyond the capacity are
+    // only kept in the thread-local records.
+    //
+    // Each segment has exactly one exporting process. If `name` belongs to
+    // a process that is still running, this fails and the caller must pick
+    // another name, e.g. one that includes its pid, when several profiled
+    // processes run at once. A segment left by an exited process is
+    // unlinked and replaced rather than reused. One that another process
+    // is still setting up counts as in use: the call waits up to
+    // `sharedSetupTimeout` for its owner to show up, then fails.
+    inline static bool exportToSharedMemory(
+        const char *name = defaultSharedName, uint32_t capacity = 1024);
+
+    // Removes the segment name; the mapping stays valid in this process.
+    static void removeSharedMemory(const char *name = defaultSharedName)
+    {
+        shm_unlink(name);
+    }
+#endif
+
+    // Consistent copy of a slot. False if the slot is unclaimed or was
+    // rewritten during every attempt.
+    inline static bool readSharedSlot(SharedSlot const &slot,
+                                      SharedStatistic  &out);
+
    private:
     inline thread_local static std::vector<Record> records;
 
+    inline static std::atomic<SharedHeader *> shared{nullptr};
+    inline thread_local static std::unordered_map<const char *, SharedSlot *>
+        sharedSlots;
+
+#if defined(__unix__)
+    static constexpr std::chrono::seconds sharedSetupTimeout{1};
+
+    // Unlinks `name` if it is a complete segment whose exporting process
+    // has exited. Returns the pid of a live exporter, 0 if the name may be
+    // created again, or -1 if the segment is still being set up (or is not
+    // a ScopeProfiler segment).
+    inline static int32_t unlinkStaleShared(const char *name);
+#endif
+
+    inline static SharedSlot *claimSharedSlot(SharedHeader *header,
+                                              const char   *tag);
+    inline static void        publishShared(SharedSlot *slot, int us);
+
     ClockType::time_point beg;
     ClockType::time_point end;
     const char           *tag;
@@ -49,8 +171,230 @@ void ScopeProfiler::onDestroy(ScopeProfiler::ClockType::time_point end)
     int  us =
         std::chrono::duration_cast<std::chrono::microseconds>(diff).count();
     records.push_back({tag, us});
+
+    if (SharedHeader *header = shared.load(std::memory_order_acquire))
+    {
+        // Slots are claimed on first use of a tag by this thread
+        auto found = sharedSlots.find(tag);
+        if (found == sharedSlots.end())
+        {
+            found =
+                sharedSlots.emplace(tag, claimSharedSlot(header, tag)).first;
+        }
+        if (SharedSlot *slot = found->second)
+        {
+            publishShared(slot, us);
+        }
+    }
+}
+
+ScopeProfiler::SharedSlot *ScopeProfiler::claimSharedSlot(SharedHeader *header,
+                                                          const char   *tag)
+{
+    uint32_t index = header->claimed.fetch_add(1, std::memory_order_relaxed);
+    if (index >= header->capacity)
+    {
+        return nullptr;
+    }
+
+    SharedSlot *slot = header->slots() + index;
+#if defined(__unix__)
+    slot->thread = static_cast<uint64_t>(::syscall(SYS_gettid));
+#else
+    slot->thread = index;
+#endif
+    std::strncpy(slot->tag, tag, sharedTagSize - 1);
+    slot->tag[sharedTagSize - 1] = '\0';
+    slot->ready.store(1, std::memory_order_release);
+    return slot;
+}
+
+void ScopeProfiler::publishShared(SharedSlot *slot, int us)
+{
+    uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint64_t count = slot->count.load(std::memory_order_relaxed);
+    int64_t  min   = slot->min_us.load(std::memory_order_relaxed);
+    int64_t  max   = slot->max_us.load(std::memory_order_relaxed);
+    slot->count.store(count + 1, std::memory_order_relaxed);
+    slot->total_us.store(slot->total_us.load(std::memory_order_relaxed) + us,
+                         std::memory_order_relaxed);
+    slot->min_us.store(count == 0 ? us : std::min<int64_t>(min, us),
+                       std::memory_order_relaxed);
+    slot->max_us.store(count == 0 ? us : std::max<int64_t>(max, us),
+                       std::memory_order_relaxed);
+    slot->last_us.store(us, std::memory_order_relaxed);
+
+    slot->sequence.store(sequence + 2, std::memory_order_release);
 }
 
+bool ScopeProfiler::readSharedSlot(SharedSlot const &slot,
+                                   SharedStatistic  &out)
+{
+    if (!slot.ready.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    for (int attempt = 0; attempt < 64; ++attempt)
+    {
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            continue;
+        }
+
+        out.count    = slot.count.load(std::memory_order_relaxed);
+        out.total_us = slot.total_us.load(std::memory_order_relaxed);
+        out.min_us   = slot.min_us.load(std::memory_order_relaxed);
+        out.max_us   = slot.max_us.load(std::memory_order_relaxed);
+        out.last_us  = slot.last_us.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before)
+        {
+            out.thread = slot.thread;
+            out.tag.assign(slot.tag, std::find(slot.tag,
+                                               slot.tag + sharedTagSize, '\0'));
+            return true;
+        }
+    }
+    return false;
+}
+
+#if defined(__unix__)
+bool ScopeProfiler::exportToSharedMemory(const char *name, uint32_t capacity)
+{
+    static std::mutex           mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (shared.load())
+    {
+        return true;
+    }
+
+    // A segment that exists but is not initialized yet belongs to a process
+    // that is exporting right now; give it a moment to finish.
+    auto deadline = std::chrono::steady_clock::now() + sharedSetupTimeout;
+    int  fd       = -1;
+    for (;;)
+    {
+        fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd >= 0 || errno != EEXIST)
+        {
+            break;
+        }
+
+        int32_t owner = unlinkStaleShared(name);
+        if (owner > 0)
+        {
+            std::cerr << "Error: Shared memory " << name
+                      << " is in use by process " << owner
+                      << "; export under another name." << std::endl;
+            return false;
+        }
+        if (owner < 0)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                std::cerr << "Error: Shared memory " << name
+                          << " is not an initialized ScopeProfiler segment; "
+                          << "remove it or export under another name."
+                          << std::endl;
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (fd < 0)
+    {
+        std::cerr << "Error: Cannot open shared memory " << name << ": "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    size_t size   = sharedSize(capacity);
+    void  *memory = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0)
+    {
+        memory =
+            mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    int error = errno;
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        std::cerr << "Error: Cannot map shared memory " << name << ": "
+                  << std::strerror(error) << std::endl;
+        return false;
+    }
+
+    // The new segment is zero-filled
+    auto *header = new (memory) SharedHeader();
+    for (uint32_t i = 0; i < capacity; ++i)
+    {
+        new (header->slots() + i) SharedSlot();
+    }
+    header->version  = sharedVersion;
+    header->capacity = capacity;
+    header->pid      = static_cast<int32_t>(getpid());
+    header->magic.store(sharedMagic, std::memory_order_release);
+
+    shared.store(header, std::memory_order_release);
+    return true;
+}
+
+int32_t ScopeProfiler::unlinkStaleShared(const char *name)
+{
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return errno == ENOENT ? 0 : -1;
+    }
+
+    int32_t     result = -1;
+    struct stat info;
+    if (fstat(fd, &info) == 0 &&
+        static_cast<size_t>(info.st_size) >= sizeof(SharedHeader))
+    {
+        void *memory =
+            mmap(nullptr, sizeof(SharedHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (memory != MAP_FAILED)
+        {
+            auto const *header = static_cast<SharedHeader const *>(memory);
+            if (header->magic.load(std::memory_order_acquire) == sharedMagic)
+            {
+                int32_t pid   = header->pid;
+                bool    alive = kill(pid, 0) == 0 || errno == EPERM;
+                result        = alive ? pid : 0;
+            }
+            munmap(memory, sizeof(SharedHeader));
+        }
+    }
+
+    // Two processes can find the same stale segment. The unlink happens
+    // under a lock on it and only while the name still refers to it, so
+    // the second one can never remove the segment the first one created.
+    if (result == 0 && flock(fd, LOCK_EX) == 0)
+    {
+        int         current = shm_open(name, O_RDONLY, 0);
+        struct stat now;
+        if (current >= 0 && fstat(current, &now) == 0 &&
+            now.st_dev == info.st_dev && now.st_ino == info.st_ino)
+        {
+            shm_unlink(name);
+        }
+        if (current >= 0)
+        {
+            close(current);
+        }
+    }
+    close(fd);
+    return result;
+}
+#endif
+
 void ScopeProfiler::printLog(std::ostream &out)
 {
     if (records.size() == 0)
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <aero_model/bspline_aero_model.hpp>
+#include <aero_model/lift_drag_aero_model.hpp>
+#include <cstddef>
+#include <functional>
+
+namespace aero_model
+{
+    enum class Interpolation
+    {
+        Linear,
+        CubicHermite
+    };
+
+    // Constant-time lookup of a 1-D function tabulated on a uniform grid.
+    // Inputs outside [x_min, x_max] are clamped to the grid ends.
+    class UniformLookupTable
+    {
+       public:
+        using Function = std::function<double(double)>;
+
+        // Tabulates `value` at `points` grid points. Hermite interpolation
+        // uses `slope` at the nodes; without it, slopes are taken from
+        // central differences of `value`.
+        bool build(const Function& value,
+                   const Function& slope,
+                   double          x_min,
+                   double          x_max,
+                   size_t          points,
+                   Interpolation   interpolation);
+
+        // Doubles the number of intervals, starting from 16, until the
+        // measured error is within `max_error` or `max_points` is reached.
+        // Returns false (keeping the largest table) if the bound is not met.
+        bool build_for_error(const Function& value,
+                             const Function& slope,
+                             double          x_min,
+                             double          x_max,
+                             double          max_error,
+                             Interpolation   interpolation,
+                             size_t          max_points = 65537);
+
+        double operator()(double x) const;
+
+        // Largest deviation from the exact function found at three interior
+        // points per interval while building.
+        double max_error() const { return max_error_; }
+        size_t size() const { return static_cast<size_t>(values_.size()); }
+
+       private:
+        Eigen::VectorXd values_;
+        Eigen::VectorXd scaled_slopes_;  // Node slope times the grid step
+        Interpolation   interpolation_{Interpolation::Linear};
+        double          x_min_{0.0};
+        double          x_max_{0.0};
+        double          inv_step_{0.0};
+        double          max_error_{0.0};
+    };
+
+    struct AeroLookupOptions
+    {
+        double        alpha_min{-3.14159265358979323846};
+        double        alpha_max{3.14159265358979323846};
+        double        beta_min{-1.57079632679489661923};
+        double        beta_max{1.57079632679489661923};
+        double        max_error{1e-4};
+        Interpolation interpolation{Interpolation::CubicHermite};
+        size_t        max_points{65537};
+    };
+
+    // cx / cz of a `BSplineAeroModel` over an alpha grid
+    class BSplineAeroLookup
+    {
+       public:
+        bool build(const BSplineAeroModel&  model,
+                   const AeroLookupOptions& options);
+
+        double cx(double alpha) const { return cx_(alpha); }
+        double cz(double alpha) const { return cz_(alpha); }
+        double max_error() const;
+
+       private:
+        UniformLookupTable cx_;
+        UniformLookupTable cz_;
+    };
+
+    // CL / CD of a `LiftDragAeroModel`. The model is separable in beta, so
+    // CL and CD are tabulated over alpha and the sideslip lift loss over
+    // beta; CY is linear in beta and computed directly.
+    class LiftDragAeroLookup
+    {
+       public:
+        bool build(const LiftDragAeroModel& model,
+                   const AeroLookupOptions& options);
+
+        LiftDragCoefficients evaluate(double alpha, double beta) const
+        {
+            return {cl_(alpha) * beta_loss_(beta), cd_(alpha),
+                    cy_beta_ * beta};
+        }
+
+        // Worst-case CL error combines the alpha and beta tables.
+        double max_error() const;
+
+       private:
+        UniformLookupTable cl_;
+        UniformLookupTable cd_;
+        UniformLookupTable beta_loss_;
+        double             cy_beta_{0.0};
+        double             max_abs_cl_{0.0};
+        double             max_abs_loss_{0.0};
+    };
+
+}  // namespace aero_model
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <aero_model/piecewise_cubic.hpp>
+#include <sq_config_reader/bspline_aero_config_reader.hpp>
+
+namespace aero_model
+{
+    struct BSplineAeroCoefficients
+    {
+        double cx;
+        double cz;
+        double dcx_dalpha;
+        double dcz_dalpha;
+    };
+
+    // Evaluator for the cx / cz curves of `BSplineAeroConfigReader`.
+    //
+    // The splines are converted once, when the model is built, so evaluation
+    // is a span lookup plus one Horner step per curve. Coefficients are
+    // returned unscaled; `scale_factor()` is the configured force scale.
+    // The curves depend on alpha only, so the alpha derivatives returned
+    // with the values are the full gradient of the coefficients.
+    //
+    //   reader.access_and_fetch_data(id);
+    //   BSplineAeroModel model;
+    //   model.build(reader.config());
+    class BSplineAeroModel
+    {
+       public:
+        static_assert(
+            sq_config_reader::BSplineAeroConfig::default_bspline_degree == 3,
+            "BSplineAeroModel evaluates cubic splines only");
+
+        bool build(const sq_config_reader::BSplineAeroConfig& config);
+
+        BSplineAeroCoefficients evaluate(double alpha) const;
+
+        // Batch evaluation of `n` angles of attack. The derivative outputs
+        // may be nullptr when only values are needed.
+        void evaluate(const double* alpha,
+                      double*       cx,
+                      double*       cz,
+                      double*       dcx_dalpha,
+                      double*       dcz_dalpha,
+                      size_t        n) const;
+
+        const PiecewiseCubic& cx_curve() const { return cx_; }
+        const PiecewiseCubic& cz_curve() const { return cz_; }
+        double                scale_factor() const { return scale_factor_; }
+
+       private:
+        PiecewiseCubic cx_;
+        PiecewiseCubic cz_;
+        double         scale_factor_{1.0};
+    };
+
+}  // namespace aero_model
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <sq_config_reader/advanced_lift_drag_config_reader.hpp>
+
+namespace aero_model
+{
+    struct LiftDragCoefficients
+    {
+        double cl;
+        double cd;
+        double cy;
+    };
+
+    // Coefficients with their partial derivatives. The coefficients do not
+    // depend on airspeed; the airspeed derivative of a force is the
+    // coefficient times `LiftDragAeroModel::force_scale_derivative`.
+    struct LiftDragDerivatives
+    {
+        LiftDragCoefficients value;
+        LiftDragCoefficients d_alpha;
+        LiftDragCoefficients d_beta;
+    };
+
+    // Structure-of-arrays batch. Inputs are angle of attack, sideslip (rad)
+    // and airspeed (m/s); `airspeed` is only read when a force output is
+    // requested. Any output pointer may be nullptr.
+    struct LiftDragBatch
+    {
+        const double* alpha{nullptr};
+        const double* beta{nullptr};
+        const double* airspeed{nullptr};
+
+        double* cl{nullptr};
+        double* cd{nullptr};
+        double* cy{nullptr};
+        double* lift{nullptr};
+        double* drag{nullptr};
+        double* side{nullptr};
+
+        // Nonzero partial derivatives of the coefficients. dCD/dbeta and
+        // dCY/dalpha are zero and dCY/dbeta is the constant cy_beta.
+        double* dcl_dalpha{nullptr};
+        double* dcl_dbeta{nullptr};
+        double* dcd_dalpha{nullptr};
+    };
+
+    // Sigmoid-blended pre/post-stall lift and drag model built from
+    // `AdvancedLiftDragConfig`:
+    //
+    //   s1      = 1 / (1 + exp( M (alpha - alpha_stall)))
+    //   s2      = 1 / (1 + exp(-M (alpha + alpha_stall)))
+    //   sigma   = 1 - s1 s2              (0 attached, 1 fully stalled)
+    //   CL_pre  = cl_alpha_0 + cl_alpha alpha
+    //   CL_post = 2 sin(alpha) |sin(alpha)| cos(alpha)
+    //   CD_pre  = cd_0 + CL_pre^2 / (pi eff)
+    //   CD_post = cd_flat_plate sin(alpha)^2
+    //   CL      = ((1 - sigma) CL_pre + sigma CL_post)
+    //             (1 - cl_beta_loss sin(beta)^2)
+    //   CD      = (1 - sigma) CD_pre + sigma CD_post
+    //   CY      = cy_beta beta
+    //
+    // with M = sigmoid_blend and eff the span efficiency times the aspect
+    // ratio. Forces are the coefficients times scale_factor * airspeed^2.
+    // This form of the blend never evaluates exp(x) / exp(x), so it stays
+    // finite for any blend sharpness.
+    //
+    // With s1' = -M s1 (1 - s1) and s2' = M s2 (1 - s2), the blend
+    // derivative is sigma' = M s1 s2 (s2 - s1), which is also finite for
+    // any M.
+    //
+    // The batch path uses Eigen's vectorized exp; it agrees with the scalar
+    // references `evaluate` and `evaluate_with_derivatives` to within
+    // `batch_tolerance`, relative to max(1, |reference|).
+    class LiftDragAeroModel
+    {
+       public:
+        static constexpr double batch_tolerance = 1e-12;
+
+        bool build(const sq_config_reader::AdvancedLiftDragConfig& config);
+
+        // Scalar reference implementation
+        LiftDragCoefficients evaluate(double alpha, double beta) const;
+
+        // Values and analytical first derivatives in one pass
+        LiftDragDerivatives evaluate_with_derivatives(double alpha,
+                                                      double beta) const;
+
+        double force_scale(double airspeed) const
+        {
+            return config_.scale_factor * airspeed * airspeed;
+        }
+
+        double force_scale_derivative(double airspeed) const
+        {
+            return 2.0 * config_.scale_factor * airspeed;
+        }
+
+        void evaluate(const LiftDragBatch& batch, size_t n) const;
+
+        const sq_config_reader::AdvancedLiftDragConfig& config() const
+        {
+            return config_;
+        }
+
+       private:
+        sq_config_reader::AdvancedLiftDragConfig config_{};
+        double                                   inv_pi_eff_{0.0};
+    };
+
+}  // namespace aero_model
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+
+namespace aero_model
+{
+    // Applies phi to `n` 3-vectors at once: out_i = phi * in_i.
+    //
+    // `in` and `out` hold the vectors back to back (x0, y0, z0, x1, ...),
+    // i.e. a column-major 3 x n matrix, and must not overlap. Nothing is
+    // allocated or copied besides the result.
+    void apply_phi(const Eigen::Matrix3d& phi,
+                   const double*          in,
+                   double*                out,
+                   size_t                 n);
+
+    void apply_phi(const Eigen::Matrix3d&                    phi,
+                   const Eigen::Ref<const Eigen::Matrix3Xd>& in,
+                   Eigen::Ref<Eigen::Matrix3Xd>              out);
+
+}  // namespace aero_model
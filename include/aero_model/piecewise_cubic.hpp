@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace aero_model
+{
+    // Cubic B-spline converted to one power-basis polynomial per knot
+    // interval, stored structure-of-arrays so a lookup touches one index in
+    // each coefficient array.
+    //
+    // On interval i the curve is
+    //   p(s) = c0[i] + c1[i] s + c2[i] s^2 + c3[i] s^3,
+    //   s    = (x - breaks[i]) * inv_width[i]  in [0, 1).
+    // Outside [lower_bound(), upper_bound()] the first / last polynomial is
+    // extended, so value and derivative stay consistent.
+    class PiecewiseCubic
+    {
+       public:
+        PiecewiseCubic() = default;
+
+        // Converts a clamped or unclamped cubic B-spline. `knots` must be
+        // non-decreasing with knots.size() == coefs.size() + 4.
+        bool build(const std::vector<double>& knots,
+                   const std::vector<double>& coefs);
+
+        double value(double x) const;
+        void   value_and_derivative(double  x,
+                                    double& value,
+                                    double& derivative) const;
+
+        // Batch evaluation of `n` points; `derivative` may be nullptr.
+        void evaluate(const double* x,
+                      double*       value,
+                      double*       derivative,
+                      size_t        n) const;
+
+        size_t interval_count() const { return c0_.size(); }
+        bool   is_uniform() const { return uniform_; }
+        double lower_bound() const { return breaks_.front(); }
+        double upper_bound() const { return breaks_.back(); }
+
+        // Index of the interval that evaluates `x`: O(1) for uniform
+        // breakpoints, branch-free binary search otherwise.
+        size_t find_interval(double x) const;
+
+       private:
+        std::vector<double> breaks_;  // interval_count() + 1 entries
+        std::vector<double> inv_width_;
+        std::vector<double> c0_;
+        std::vector<double> c1_;
+        std::vector<double> c2_;
+        std::vector<double> c3_;
+
+        bool   uniform_{false};
+        double origin_{0.0};
+        double inv_step_{0.0};
+    };
+
+}  // namespace aero_model
@@ -1,45 +1,61 @@
 #ifndef SQ_CONFIG_READER_ADVANCED_LIFT_DRAG_CONFIG_READER_HPP_
 #define SQ_CONFIG_READER_ADVANCED_LIFT_DRAG_CONFIG_READER_HPP_
 
-#include <sq_config_reader/sq_config_reader.hpp>
+#include <sq_config_reader/schema_config_reader.hpp>
 
 namespace sq_config_reader
 {
-    class AdvancedLiftDragConfigReader : public SQLiteConfigReader
+    struct AdvancedLiftDragConfig
+    {
+        double sigmoid_blend;  // Sigmoid blending parameter
+        double cl_alpha_0;     // Initial lift coefficient
+        double cl_alpha;       // Lift curve slope (per radian)
+        double alpha_stall;    // Stall angle (radians)
+        double eff;            // Wing efficiency factor
+        double cd_0;           // Zero-lift drag coefficient
+        double cd_flat_plate;  // Flat plate drag coefficient
+        double cy_beta;        // Side force derivative
+        double cl_beta_loss;   // Lift loss factor with sideslip
+        double scale_factor;   // Scale factor for aerodynamic forces
+
+        static constexpr std::string_view table_name =
+            "advanced_lift_drag_config";
+        static constexpr auto fields()
+        {
+            using C = AdvancedLiftDragConfig;
+            return std::make_tuple(
+                schema::field("sigmoid_blend", &C::sigmoid_blend),
+                schema::field("cl_alpha_0", &C::cl_alpha_0),
+                schema::field("cl_alpha", &C::cl_alpha),
+                schema::field("alpha_stall", &C::alpha_stall),
+                schema::field("eff", &C::eff),
+                schema::field("cd_0", &C::cd_0),
+                schema::field("cd_flat_plate", &C::cd_flat_plate),
+                schema::field("cy_beta", &C::cy_beta),
+                schema::field("cl_beta_loss", &C::cl_beta_loss),
+                schema::field("scale_factor", &C::scale_factor));
+        }
+    };
+
+    class AdvancedLiftDragConfigReader
+        : public SchemaConfigReader<AdvancedLiftDragConfig>
     {
        public:
         AdvancedLiftDragConfigReader();
 
         // Getters for the configuration values
-        double get_sigmoid_blend() const { return sigmoid_blend_; }
-        double get_cl_alpha_0() const { return cl_alpha_0_; }
-        double get_cl_alpha() const { return cl_alpha_; }
-        double get_alpha_stall() const { return alpha_stall_; }
-        double get_eff() const { return eff_; }
-        double get_cd_0() const { return cd_0_; }
-        double get_cd_flat_plate() const { return cd_flat_plate_; }
-        double get_cy_beta() const { return cy_beta_; }
-        double get_cl_beta_loss() const { return cl_beta_loss_; }
-        double get_scale_factor() const { return scale_factor_; }
-
-       protected:
-        bool prepare_statement(int id) override;
-        bool fetch_data() override;
-
-       private:
-        // Configuration values
-        double sigmoid_blend_;  // Sigmoid blending parameter
-        double cl_alpha_0_;     // Initial lift coefficient
-        double cl_alpha_;       // Lift curve slope (per radian)
-        double alpha_stall_;    // Stall angle (radians)
-        double eff_;            // Wing efficiency factor
-        double cd_0_;           // Zero-lift drag coefficient
-        double cd_flat_plate_;  // Flat plate drag coefficient
-        double cy_beta_;        // Side force derivative
-        double cl_beta_loss_;   // Lift loss factor with sideslip
-        double scale_factor_;   // Scale factor for aerodynamic forces
+        double get_sigmoid_blend() const { return config_.sigmoid_blend; }
+        double get_cl_alpha_0() const { return config_.cl_alpha_0; }
+        double get_cl_alpha() const { return config_.cl_alpha; }
+        double get_alpha_stall() const { return config_.alpha_stall; }
+        double get_eff() const { return config_.eff; }
+        double get_cd_0() const { return config_.cd_0; }
+        double get_cd_flat_plate() const { return config_.cd_flat_plate; }
+        double get_cy_beta() const { return config_.cy_beta; }
+        double get_cl_beta_loss() const { return config_.cl_beta_loss; }
+        double get_scale_factor() const { return config_.scale_factor; }
     };
 
 }  // namespace sq_config_reader
 
-#endif  // SQ_CONFIG_READER_ADVANCED_LIFT_DRAG_CONFIG_READER_HPP_
\ No newline at end of file
+#endif  // SQ_CONFIG_READER_ADVANCED_LIFT_DRAG_CONFIG_READER_HPP_
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <sq_config_reader/sq_config_reader.hpp>
+#include <string>
+#include <vector>
+
+namespace sq_config_reader
+{
+    struct ConfigLoadRequest
+    {
+        SQLiteConfigReader* reader;
+        int                 id{1};
+    };
+
+    struct ConfigLoadReport
+    {
+        // One entry per failed request, in request order
+        std::vector<std::string> errors;
+
+        bool ok() const { return errors.empty(); }
+    };
+
+    // Loads every request concurrently, each reader on its own connection,
+    // and returns once all of them have finished. Latency is roughly that of
+    // the slowest reader. `thread_count` of 0 uses one thread per request,
+    // capped by the hardware concurrency.
+    //
+    // The readers must outlive the call and must not be used by other
+    // threads while it runs.
+    ConfigLoadReport load_configs(
+        const std::vector<ConfigLoadRequest>& requests,
+        size_t                                thread_count = 0);
+
+}  // namespace sq_config_reader
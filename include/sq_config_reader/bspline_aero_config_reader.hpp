@@ -1,29 +1,60 @@
 #pragma once
 
-#include <sq_config_reader/sq_config_reader.hpp>
+#include <sq_config_reader/schema_config_reader.hpp>
 
 namespace sq_config_reader
 {
-    class BSplineAeroConfigReader : public SQLiteConfigReader
+    struct BSplineAeroConfig
     {
-       private:
-        std::vector<double> cx_coefs_;
-        std::vector<double> cx_knots_;
-        std::vector<double> cz_coefs_;
-        std::vector<double> cz_knots_;
-        double              scale_factor_{1.0};  // Default to 1.0
+        static constexpr int    default_bspline_degree = 3;
+        static constexpr size_t default_diff_between_knots_size_and_coefs_size =
+            default_bspline_degree + 1;
 
+        std::vector<double> cx_coefs;
+        std::vector<double> cx_knots;
+        std::vector<double> cz_coefs;
+        std::vector<double> cz_knots;
+        double              scale_factor{1.0};  // Default to 1.0
+
+        static constexpr std::string_view table_name = "bspline_aero_config";
+        static constexpr auto             fields()
+        {
+            using C = BSplineAeroConfig;
+            return std::make_tuple(
+                schema::field("cx_coefs", &C::cx_coefs, schema::non_empty),
+                schema::field("cx_knots", &C::cx_knots, schema::non_empty),
+                schema::field("cz_coefs", &C::cz_coefs, schema::non_empty),
+                schema::field("cz_knots", &C::cz_knots, schema::non_empty),
+                schema::field("scale_factor", &C::scale_factor));
+        }
+
+        // Knots size should equal coefs size plus degree + 1
+        static bool validate(const BSplineAeroConfig& config);
+    };
+
+    class BSplineAeroConfigReader : public SchemaConfigReader<BSplineAeroConfig>
+    {
        public:
         BSplineAeroConfigReader();
-        virtual bool prepare_statement(int id = 1) override;
-        virtual bool fetch_data() override;
 
         // Accessors
-        const std::vector<double>& get_cx_coefs() const { return cx_coefs_; }
-        const std::vector<double>& get_cx_knots() const { return cx_knots_; }
-        const std::vector<double>& get_cz_coefs() const { return cz_coefs_; }
-        const std::vector<double>& get_cz_knots() const { return cz_knots_; }
-        double get_scale_factor() const { return scale_factor_; }
+        const std::vector<double>& get_cx_coefs() const
+        {
+            return config_.cx_coefs;
+        }
+        const std::vector<double>& get_cx_knots() const
+        {
+            return config_.cx_knots;
+        }
+        const std::vector<double>& get_cz_coefs() const
+        {
+            return config_.cz_coefs;
+        }
+        const std::vector<double>& get_cz_knots() const
+        {
+            return config_.cz_knots;
+        }
+        double get_scale_factor() const { return config_.scale_factor; }
     };
 
-}  // namespace sq_config_reader
\ No newline at end of file
+}  // namespace sq_config_reader
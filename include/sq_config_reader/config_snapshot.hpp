@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sq_config_reader
+{
+    // One flat array of a loaded configuration.
+    struct SnapshotField
+    {
+        const double* data;
+        size_t        size;
+    };
+
+    // Identity of the database content a snapshot was taken from. The WAL
+    // file is part of it because committed rows may still live there.
+    struct DatabaseKey
+    {
+        std::uint64_t db_size{0};
+        std::int64_t  db_mtime_ns{0};
+        std::uint64_t wal_size{0};
+        std::int64_t  wal_mtime_ns{0};
+        std::uint64_t content_hash{0};
+
+        bool operator==(const DatabaseKey& other) const
+        {
+            return db_size == other.db_size &&
+                   db_mtime_ns == other.db_mtime_ns &&
+                   wal_size == other.wal_size &&
+                   wal_mtime_ns == other.wal_mtime_ns &&
+                   content_hash == other.content_hash;
+        }
+        bool operator!=(const DatabaseKey& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    // Memory-mapped binary snapshot of one configuration row.
+    //
+    // Snapshots are written next to the database as
+    // `<db_file>.<table>.<id>.snap` and are keyed by the size, mtime and
+    // content hash of the database, so any change to the database invalidates
+    // them. The file is a versioned header, a field table and the field
+    // payloads, each payload aligned to 64 bytes. Files are written to a
+    // private temporary name and renamed into place, so concurrently starting
+    // processes either see a complete snapshot or none.
+    //
+    // Validating a key hashes the whole database and WAL file, so its cost
+    // grows with the database size, not with the size of the row. Checking
+    // an existing snapshot computes the key once. A load from SQLite computes
+    // it twice more, before and after reading. Snapshots are only written
+    // when the database directory is writable.
+    class ConfigSnapshot
+    {
+       private:
+        void*                      mapping_{nullptr};
+        size_t                     mapping_size_{0};
+        std::vector<SnapshotField> fields_;
+
+       public:
+        ConfigSnapshot() = default;
+        ~ConfigSnapshot();
+
+        ConfigSnapshot(const ConfigSnapshot&)            = delete;
+        ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+        // Maps the snapshot for (db_file, table_name, id) if it exists and is
+        // still valid for the current database. The fields point straight
+        // into the mapping and stay valid until this object is destroyed.
+        bool open(const std::string& db_file,
+                  const std::string& table_name,
+                  int                id);
+
+        const std::vector<SnapshotField>& fields() const { return fields_; }
+
+        // Writes a snapshot of `fields` for (db_file, table_name, id). `key`
+        // must describe the database the fields were loaded from.
+        static bool write(const std::string&                db_file,
+                          const std::string&                table_name,
+                          int                               id,
+                          const DatabaseKey&                key,
+                          const std::vector<SnapshotField>& fields);
+
+        // Whether snapshots can be written next to `db_file`. Checked once
+        // per directory and process, so a read-only data directory (e.g. an
+        // installed share/ path) silently skips the write.
+        static bool can_write(const std::string& db_file);
+
+        static bool read_database_key(const std::string& db_file,
+                                      DatabaseKey&       key);
+
+        static std::string path_for(const std::string& db_file,
+                                    const std::string& table_name,
+                                    int                id);
+    };
+
+}  // namespace sq_config_reader
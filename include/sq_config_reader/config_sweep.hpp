@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <memory>
+#include <sq_config_reader/async_config_loader.hpp>
+#include <sq_config_reader/thread_pool.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace sq_config_reader
+{
+    // Loads every id with a `Reader` and runs `evaluate(reader, id)` on it,
+    // spread over a work-stealing pool. Each worker owns one reader, and so
+    // one read-only connection that is kept across its ids. Result i of
+    // `results` belongs to ids[i]; the vector is sized up front and every
+    // slot is written by exactly one task. `thread_count` of 0 uses the
+    // hardware concurrency.
+    //
+    //   std::vector<int> ids;
+    //   PhiAeroConfigReader().fetch_ids(ids);
+    //   std::vector<double> norms;
+    //   sweep_configs<PhiAeroConfigReader>(
+    //       ids, norms, [](const PhiAeroConfigReader& reader, int)
+    //       { return reader.get_phi_matrix().norm(); });
+    //
+    // The snapshot cache is disabled for the sweep readers, so a sweep does
+    // not leave a snapshot file behind for every row. Ids that fail to load
+    // or evaluate keep a default-constructed result and are reported.
+    template <typename Reader, typename Result, typename Evaluate>
+    ConfigLoadReport sweep_configs(const std::vector<int>& ids,
+                                   std::vector<Result>&    results,
+                                   Evaluate                evaluate,
+                                   size_t                  thread_count = 0)
+    {
+        static_assert(!std::is_same_v<Result, bool>,
+                      "std::vector<bool> slots cannot be written "
+                      "concurrently");
+
+        ConfigLoadReport report;
+        results.assign(ids.size(), Result{});
+        if (ids.empty())
+        {
+            return report;
+        }
+
+        if (thread_count == 0)
+        {
+            size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+            thread_count    = std::min(ids.size(), hardware);
+        }
+
+        std::vector<std::unique_ptr<Reader>> readers;
+        readers.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            readers.push_back(std::make_unique<Reader>());
+            readers.back()->set_snapshot_cache_enabled(false);
+        }
+
+        std::vector<std::future<void>> done;
+        done.reserve(ids.size());
+        {
+            ThreadPool pool(thread_count);
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                done.push_back(pool.submit(
+                    [&, i]()
+                    {
+                        Reader& reader = *readers[pool.worker_index()];
+                        if (!reader.access_and_fetch_data(ids[i]))
+                        {
+                            throw std::runtime_error("failed to load");
+                        }
+                        const Reader& loaded = reader;
+                        results[i]           = evaluate(loaded, ids[i]);
+                    }));
+            }
+        }
+
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            try
+            {
+                done[i].get();
+            }
+            catch (const std::exception& e)
+            {
+                report.errors.push_back(readers.front()->get_table_name() +
+                                        " (id " + std::to_string(ids[i]) +
+                                        "): " + e.what());
+            }
+        }
+
+        return report;
+    }
+
+}  // namespace sq_config_reader
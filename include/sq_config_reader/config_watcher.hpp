@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sq_config_reader/rcu_cell.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sq_config_reader
+{
+    // Watches `$AERO_SIM_DATA_DIR/aero_sim_params.db` with inotify and hot
+    // reloads the registered configurations when their rows change.
+    //
+    // Each registered (reader type, id) pair is exposed as an `RcuCell`.
+    // Reloads run on the watcher thread: a fresh reader is loaded through
+    // `access_and_fetch_data`, so the readers' own validation applies, and is
+    // only published if it succeeds. A row that fails validation keeps the
+    // previously published version.
+    class ConfigWatcher
+    {
+       public:
+        ConfigWatcher();
+        ~ConfigWatcher();
+
+        ConfigWatcher(const ConfigWatcher&)            = delete;
+        ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+        // Loads row `id` with `Reader` and registers it for hot reload.
+        // Returns nullptr if the initial load fails.
+        template <typename Reader>
+        std::shared_ptr<RcuCell<Reader>> watch(int id = 1);
+
+        // Starts / stops the background watcher thread.
+        bool start();
+        void stop();
+
+        // Quiet period after the last file event before rows are re-read, so
+        // a multi-statement update is picked up once and in full.
+        void set_debounce_ms(int debounce_ms) { debounce_ms_ = debounce_ms; }
+
+        // Re-reads every registered row and publishes the changed ones.
+        // Called by the watcher thread; exposed for manual triggering.
+        void reload_changed();
+
+       private:
+        struct Entry
+        {
+            std::string           table_name;
+            int                   id;
+            std::uint64_t         fingerprint;
+            std::function<bool()> reload;
+        };
+
+        std::string        db_dir_;
+        std::string        db_name_;
+        std::string        db_file_;
+        int                inotify_fd_{-1};
+        int                stop_fd_{-1};
+        int                debounce_ms_{100};
+        std::atomic<bool>  running_{false};
+        std::thread        thread_;
+        std::mutex         entries_mutex_;
+        std::vector<Entry> entries_;
+
+        bool row_fingerprint(const std::string& table_name,
+                             int                id,
+                             std::uint64_t&     fingerprint) const;
+        void add_entry(Entry entry);
+        void run();
+    };
+
+    template <typename Reader>
+    std::shared_ptr<RcuCell<Reader>> ConfigWatcher::watch(int id)
+    {
+        auto reader = std::make_unique<Reader>();
+        if (reader->get_db_file() != db_file_)
+        {
+            std::cerr << "Reader database " << reader->get_db_file()
+                      << " is not the watched database " << db_file_
+                      << std::endl;
+            return nullptr;
+        }
+
+        std::uint64_t fingerprint = 0;
+        if (!row_fingerprint(reader->get_table_name(), id, fingerprint) ||
+            !reader->access_and_fetch_data(id))
+        {
+            std::cerr << "Failed to load initial configuration from "
+                      << reader->get_table_name() << " (id " << id << ")"
+                      << std::endl;
+            return nullptr;
+        }
+        reader->disconnect();
+
+        std::string table_name = reader->get_table_name();
+        auto        cell = std::make_shared<RcuCell<Reader>>(std::move(reader));
+
+        std::weak_ptr<RcuCell<Reader>> weak_cell = cell;
+        auto                           reload    = [weak_cell, id]() -> bool
+        {
+            auto target = weak_cell.lock();
+            if (!target)
+            {
+                // Nobody reads this configuration anymore.
+                return true;
+            }
+
+            auto next = std::make_unique<Reader>();
+            if (!next->access_and_fetch_data(id))
+            {
+                return false;
+            }
+            next->disconnect();
+            target->publish(std::move(next));
+            return true;
+        };
+
+        add_entry({table_name, id, fingerprint, std::move(reload)});
+        return cell;
+    }
+
+}  // namespace sq_config_reader
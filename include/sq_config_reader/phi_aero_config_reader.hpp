@@ -1,21 +1,43 @@
 #pragma once
 
-#include <sq_config_reader/sq_config_reader.hpp>
+#include <Eigen/Core>
+#include <sq_config_reader/schema_config_reader.hpp>
 
 namespace sq_config_reader
 {
-    class PhiAeroConfigReader : public SQLiteConfigReader
+    struct PhiAeroConfig
     {
-       private:
-        std::vector<double> phi_;
+        static constexpr size_t phi_matrix_flatten_size = 9;
+
+        std::vector<double> phi;  // Row-major 3x3
 
+        static constexpr std::string_view table_name = "phi_aero_config";
+        static constexpr auto             fields()
+        {
+            return std::make_tuple(
+                schema::field("phi_coefs", &PhiAeroConfig::phi,
+                              schema::exact_size<phi_matrix_flatten_size>));
+        }
+    };
+
+    class PhiAeroConfigReader : public SchemaConfigReader<PhiAeroConfig>
+    {
        public:
+        // Column-major storage (Eigen default); filled from the row-major
+        // `phi_coefs`, so get_phi_matrix()(r, c) == get_phi()[3 * r + c].
+        using PhiMatrix = Eigen::Matrix3d;
+
         PhiAeroConfigReader();
-        virtual bool prepare_statement(int id = 1) override;
-        virtual bool fetch_data() override;
 
-        // Accessor
-        const std::vector<double>& get_phi() const { return phi_; }
+        // Accessors
+        const std::vector<double>& get_phi() const { return config_.phi; }
+        const PhiMatrix& get_phi_matrix() const { return phi_matrix_; }
+
+       protected:
+        void on_config_loaded() override;
+
+       private:
+        PhiMatrix phi_matrix_{PhiMatrix::Zero()};
     };
 
-}  // namespace sq_config_reader
\ No newline at end of file
+}  // namespace sq_config_reader
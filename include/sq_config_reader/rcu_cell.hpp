@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace sq_config_reader
+{
+    // Read-copy-update holder for a configuration object.
+    //
+    // Readers take a `ReadGuard` and never lock: entering and leaving a read
+    // section is one atomic increment and one atomic decrement on a counter
+    // selected by the current epoch parity. Writers swap in a fully built
+    // object with a single atomic pointer exchange, then wait for a grace
+    // period (every reader that could still see the previous object has left)
+    // before deleting it. A reader therefore always sees either the old or the
+    // new object in full, never a mix of both.
+    //
+    // Read sections should be short (one control loop iteration); a reader
+    // that keeps a guard alive delays reclamation, not other readers.
+    template <typename T>
+    class RcuCell
+    {
+       private:
+        struct alignas(64) ReaderCounter
+        {
+            std::atomic<long> value{0};
+        };
+
+        std::atomic<const T*>      current_;
+        std::atomic<unsigned>      epoch_{0};
+        std::atomic<std::uint64_t> version_{1};
+        mutable ReaderCounter      readers_[2];
+        std::mutex                 writer_mutex_;
+
+        void wait_for_readers(unsigned parity) const
+        {
+            while (readers_[parity].value.load(std::memory_order_acquire) != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // Two epoch flips are needed: a reader may have sampled the epoch
+        // during the previous grace period and registered on either parity.
+        void synchronize()
+        {
+            unsigned epoch = epoch_.load(std::memory_order_relaxed);
+            epoch_.store(epoch + 1, std::memory_order_seq_cst);
+            wait_for_readers(epoch & 1u);
+            epoch_.store(epoch + 2, std::memory_order_seq_cst);
+            wait_for_readers((epoch + 1) & 1u);
+        }
+
+       public:
+        class ReadGuard
+        {
+           private:
+            const ReaderCounter* counter_;
+            const T*             value_;
+
+            friend class RcuCell;
+            ReadGuard(const ReaderCounter* counter, const T* value)
+                : counter_(counter), value_(value)
+            {
+            }
+
+           public:
+            ReadGuard(ReadGuard&& other) noexcept
+                : counter_(std::exchange(other.counter_, nullptr)),
+                  value_(std::exchange(other.value_, nullptr))
+            {
+            }
+            ReadGuard(const ReadGuard&)            = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+            ReadGuard& operator=(ReadGuard&&)      = delete;
+
+            ~ReadGuard()
+            {
+                if (counter_)
+                {
+                    const_cast<ReaderCounter*>(counter_)->value.fetch_sub(
+                        1, std::memory_order_release);
+                }
+            }
+
+            const T* get() const { return value_; }
+            const T* operator->() const { return value_; }
+            const T& operator*() const { return *value_; }
+        };
+
+        explicit RcuCell(std::unique_ptr<const T> initial)
+            : current_(initial.release())
+        {
+        }
+
+        RcuCell(const RcuCell&)            = delete;
+        RcuCell& operator=(const RcuCell&) = delete;
+
+        ~RcuCell() { delete current_.load(std::memory_order_acquire); }
+
+        // Lock-free read side, safe to call from real-time threads.
+        ReadGuard read() const
+        {
+            unsigned       epoch   = epoch_.load(std::memory_order_seq_cst);
+            ReaderCounter* counter = &readers_[epoch & 1u];
+            counter->value.fetch_add(1, std::memory_order_seq_cst);
+            return ReadGuard(counter,
+                             current_.load(std::memory_order_seq_cst));
+        }
+
+        // Publishes a new object and reclaims the previous one once no reader
+        // holds it. Blocks the calling (writer) thread for the grace period.
+        void publish(std::unique_ptr<const T> next)
+        {
+            std::lock_guard<std::mutex> lock(writer_mutex_);
+            const T* previous =
+                current_.exchange(next.release(), std::memory_order_seq_cst);
+            version_.fetch_add(1, std::memory_order_release);
+            synchronize();
+            delete previous;
+        }
+
+        // Incremented on every publish; lets readers detect a reload cheaply.
+        std::uint64_t version() const
+        {
+            return version_.load(std::memory_order_acquire);
+        }
+    };
+
+}  // namespace sq_config_reader
@@ -0,0 +1,356 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <sq_config_reader/sq_config_reader.hpp>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sq_config_reader
+{
+    namespace schema
+    {
+        // Describes one column of a config table and the struct member it is
+        // decoded into. `validate` reports its own error.
+        template <typename Config, typename T>
+        struct Field
+        {
+            using value_type = T;
+
+            std::string_view name;
+            T Config::*member;
+            bool (*validate)(std::string_view column, const T& value);
+        };
+
+        template <typename T>
+        struct identity
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        bool accept(std::string_view, const T&)
+        {
+            return true;
+        }
+
+        // The validator does not take part in deduction, so captureless
+        // lambdas can be passed as well as functions.
+        template <typename Config, typename T>
+        constexpr Field<Config, T> field(
+            std::string_view name,
+            T Config::*member,
+            bool (*validate)(std::string_view,
+                             const typename identity<T>::type&) = accept<T>)
+        {
+            return {name, member, validate};
+        }
+
+        // Column decoders. A scalar takes the first value of the CSV text, a
+        // vector takes all of them. Both parse straight into the destination.
+        bool decode(std::string_view column, const char* text, double& value);
+        bool decode(std::string_view     column,
+                    const char*          text,
+                    std::vector<double>& values);
+
+        inline SnapshotField snapshot_field(const double& value)
+        {
+            return {&value, 1};
+        }
+        inline SnapshotField snapshot_field(const std::vector<double>& values)
+        {
+            return {values.data(), values.size()};
+        }
+
+        inline bool restore(const SnapshotField& field, double& value)
+        {
+            if (field.size != 1)
+            {
+                return false;
+            }
+            value = field.data[0];
+            return true;
+        }
+        inline bool restore(const SnapshotField&  field,
+                            std::vector<double>& values)
+        {
+            values.assign(field.data, field.data + field.size);
+            return true;
+        }
+
+        // Common validators
+        inline bool non_empty(std::string_view           column,
+                              const std::vector<double>& values)
+        {
+            if (values.empty())
+            {
+                std::cerr << "Error: " << column << " is empty after parsing."
+                          << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        template <size_t N>
+        bool exact_size(std::string_view           column,
+                        const std::vector<double>& values)
+        {
+            if (values.size() != N)
+            {
+                std::cerr << "Error: " << column << " must have exactly " << N
+                          << " elements, but got " << values.size()
+                          << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        // Optional whole-struct check: `static bool validate(const Config&)`
+        template <typename Config, typename = void>
+        struct has_validate : std::false_type
+        {
+        };
+        template <typename Config>
+        struct has_validate<Config,
+                            std::void_t<decltype(Config::validate(
+                                std::declval<const Config&>()))>>
+            : std::true_type
+        {
+        };
+
+        constexpr std::string_view SELECT_PREFIX = "SELECT ";
+        constexpr std::string_view COLUMN_SEP    = ", ";
+        constexpr std::string_view FROM_CLAUSE   = " FROM ";
+        constexpr std::string_view WHERE_CLAUSE  = " WHERE id = ?";
+
+        template <typename Config>
+        constexpr size_t select_length()
+        {
+            size_t length = SELECT_PREFIX.size() + FROM_CLAUSE.size() +
+                            Config::table_name.size() + WHERE_CLAUSE.size();
+            std::apply(
+                [&length](const auto&... fields)
+                { ((length += fields.name.size() + COLUMN_SEP.size()), ...); },
+                Config::fields());
+            return length - COLUMN_SEP.size();
+        }
+
+        // "SELECT <col>, <col>, ... FROM <table> WHERE id = ?", built at
+        // compile time and null-terminated.
+        template <typename Config, size_t Length>
+        constexpr std::array<char, Length + 1> build_select()
+        {
+            std::array<char, Length + 1> text{};
+            size_t                       pos    = 0;
+            auto                         append = [&](std::string_view part)
+            {
+                for (char c : part)
+                {
+                    text[pos++] = c;
+                }
+            };
+
+            append(SELECT_PREFIX);
+            std::apply(
+                [&](const auto&... fields)
+                {
+                    bool first = true;
+                    ((append(first ? std::string_view() : COLUMN_SEP),
+                      append(fields.name), first = false),
+                     ...);
+                },
+                Config::fields());
+            append(FROM_CLAUSE);
+            append(Config::table_name);
+            append(WHERE_CLAUSE);
+            text[pos] = '\0';
+            return text;
+        }
+    }  // namespace schema
+
+    // Reader for any config struct that declares its table and columns:
+    //
+    //   struct MyConfig
+    //   {
+    //       double              gain;
+    //       std::vector<double> table;
+    //
+    //       static constexpr std::string_view table_name = "my_config";
+    //       static constexpr auto fields()
+    //       {
+    //           return std::make_tuple(
+    //               schema::field("gain", &MyConfig::gain),
+    //               schema::field("table", &MyConfig::table,
+    //                             schema::non_empty));
+    //       }
+    //   };
+    //
+    // The SELECT text is generated at compile time, columns are decoded by an
+    // unrolled fold over the field list, and the binary snapshot cache is
+    // supported without any per-reader code.
+    template <typename Config>
+    class SchemaConfigReader : public SQLiteConfigReader
+    {
+       public:
+        static constexpr size_t select_length = schema::select_length<Config>();
+        static constexpr std::array<char, select_length + 1> select_sql =
+            schema::build_select<Config, select_length>();
+
+        explicit SchemaConfigReader(const std::string& db_name)
+            : SQLiteConfigReader(db_name, std::string(Config::table_name))
+        {
+        }
+
+        virtual bool prepare_statement(int id = 1) override
+        {
+            // The SELECT is the same for every id, so a statement kept from
+            // an earlier load is only rebound.
+            if (stmt)
+            {
+                sqlite3_reset(stmt);
+            }
+            else if (sqlite3_prepare_v2(db, select_sql.data(),
+                                        static_cast<int>(select_sql.size()),
+                                        &stmt, nullptr) != SQLITE_OK)
+            {
+                std::cerr << "Failed to prepare statement: "
+                          << sqlite3_errmsg(db) << std::endl;
+                return false;
+            }
+
+            if (sqlite3_bind_int(stmt, 1, id) != SQLITE_OK)
+            {
+                std::cerr << "Failed to bind id parameter: "
+                          << sqlite3_errmsg(db) << std::endl;
+                return false;
+            }
+
+            return true;
+        }
+
+        virtual bool fetch_data() override
+        {
+            int rc = sqlite3_step(stmt);
+            if (rc == SQLITE_ROW)
+            {
+                if (!decode_columns(std::make_index_sequence<field_count>()) ||
+                    !validate_config())
+                {
+                    return false;
+                }
+                on_config_loaded();
+                return true;
+            }
+            else if (rc == SQLITE_DONE)
+            {
+                std::cerr << "No data found!" << std::endl;
+            }
+            else
+            {
+                std::cerr << "Error executing query: " << sqlite3_errmsg(db)
+                          << std::endl;
+            }
+            return false;
+        }
+
+        const Config& config() const { return config_; }
+
+       protected:
+        static constexpr size_t field_count =
+            std::tuple_size_v<decltype(Config::fields())>;
+
+        Config config_{};
+
+        // Called after every successful load, from SQLite or a snapshot, for
+        // readers that keep derived data next to the config.
+        virtual void on_config_loaded() {}
+
+        std::vector<SnapshotField> snapshot_fields() const override
+        {
+            return std::apply(
+                [this](const auto&... fields)
+                {
+                    return std::vector<SnapshotField>{
+                        schema::snapshot_field(config_.*(fields.member))...};
+                },
+                Config::fields());
+        }
+
+        bool restore_snapshot(const std::vector<SnapshotField>& fields) override
+        {
+            if (fields.size() != field_count ||
+                !restore_columns(fields,
+                                 std::make_index_sequence<field_count>()) ||
+                !validate_config())
+            {
+                return false;
+            }
+            on_config_loaded();
+            return true;
+        }
+
+       private:
+        template <size_t I>
+        bool validate_column() const
+        {
+            constexpr auto field = std::get<I>(Config::fields());
+            return field.validate(field.name, config_.*(field.member));
+        }
+
+        template <size_t I>
+        bool decode_column()
+        {
+            constexpr auto field = std::get<I>(Config::fields());
+            const char*    text  = reinterpret_cast<const char*>(
+                sqlite3_column_text(stmt, static_cast<int>(I)));
+            if (!text)
+            {
+                std::cerr << "Error: Missing or NULL data in the database ("
+                          << field.name << ")." << std::endl;
+                return false;
+            }
+
+            return schema::decode(field.name, text, config_.*(field.member)) &&
+                   validate_column<I>();
+        }
+
+        template <size_t I>
+        bool restore_column(const SnapshotField& snapshot)
+        {
+            constexpr auto field = std::get<I>(Config::fields());
+            return schema::restore(snapshot, config_.*(field.member)) &&
+                   validate_column<I>();
+        }
+
+        template <size_t... I>
+        bool decode_columns(std::index_sequence<I...>)
+        {
+            return (decode_column<I>() && ...);
+        }
+
+        template <size_t... I>
+        bool restore_columns(const std::vector<SnapshotField>& fields,
+                             std::index_sequence<I...>)
+        {
+            return (restore_column<I>(fields[I]) && ...);
+        }
+
+        bool validate_config() const
+        {
+            if constexpr (schema::has_validate<Config>::value)
+            {
+                return Config::validate(config_);
+            }
+            else
+            {
+                return true;
+            }
+        }
+    };
+
+}  // namespace sq_config_reader
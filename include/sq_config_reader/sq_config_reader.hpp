@@ -1,6 +1,8 @@
 #pragma once
 #include <sqlite3.h>
 
+#include <future>
+#include <sq_config_reader/config_snapshot.hpp>
 #include <string>
 #include <vector>
 
@@ -15,9 +17,23 @@ namespace sq_config_reader
         std::string   db_file;
         std::string   database_name;
         std::string   table_name;
+        bool          snapshot_cache_enabled{true};
 
         std::vector<double> parse_csv(const std::string& csv_str);
 
+        // Binary snapshot cache hooks. A reader that returns its loaded
+        // values as flat arrays, and can restore itself from them, skips
+        // SQLite entirely while the snapshot next to the database is valid.
+        virtual std::vector<SnapshotField> snapshot_fields() const
+        {
+            return {};
+        }
+        virtual bool restore_snapshot(const std::vector<SnapshotField>& fields)
+        {
+            (void)fields;
+            return false;
+        }
+
        public:
         SQLiteConfigReader(const std::string& db_name,
                            const std::string& tbl_name);
@@ -26,8 +42,28 @@ namespace sq_config_reader
         virtual bool prepare_statement(int id = 1) = 0;
         virtual bool fetch_data()                  = 0;
 
+        // The connection is opened read-only on first use and kept until
+        // disconnect() or destruction.
         bool connect();
+        void disconnect();
         bool access_and_fetch_data(int id = 1);
+
+        // All ids of the reader's table, in ascending order
+        bool fetch_ids(std::vector<int>& ids);
+
+        // Runs access_and_fetch_data on a new thread. The reader must stay
+        // alive and untouched until the future is ready.
+        std::future<bool> access_and_fetch_data_async(int id = 1);
+
+        // On by default. Keying a snapshot hashes the whole database file
+        // (see ConfigSnapshot), so large databases may prefer it off.
+        void set_snapshot_cache_enabled(bool enabled)
+        {
+            snapshot_cache_enabled = enabled;
+        }
+
+        const std::string& get_db_file() const { return db_file; }
+        const std::string& get_table_name() const { return table_name; }
     };
 
 }  // namespace sq_config_reader
\ No newline at end of file
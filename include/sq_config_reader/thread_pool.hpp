@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace sq_config_reader
+{
+    // Small fixed-size work-stealing thread pool. Every worker owns a task
+    // deque: tasks submitted from outside the pool are spread round-robin
+    // over the deques, tasks submitted by a worker go to its own deque. A
+    // worker runs its own tasks oldest first and, once it runs dry, steals
+    // the newest task of another worker. The destructor drains all deques
+    // before joining.
+    class ThreadPool
+    {
+       public:
+        static constexpr size_t no_worker = static_cast<size_t>(-1);
+
+        explicit ThreadPool(size_t thread_count);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        template <typename F>
+        std::future<std::invoke_result_t<F>> submit(F&& task);
+
+        size_t size() const { return workers_.size(); }
+
+        // Index in [0, size()) of the calling worker, or `no_worker` when
+        // called from a thread that does not belong to this pool. Lets tasks
+        // use per-worker state without locking.
+        size_t worker_index() const;
+
+       private:
+        struct alignas(64) WorkerQueue
+        {
+            std::mutex                        mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues_;
+        std::vector<std::thread>                  workers_;
+        std::atomic<size_t> pending_{0};  // Queued, not yet started
+        std::atomic<size_t> next_queue_{0};
+
+        // Idle workers sleep on `cv_`
+        std::mutex              mutex_;
+        std::condition_variable cv_;
+        bool                    stopping_{false};
+
+        void enqueue(std::function<void()> task);
+        bool try_pop(size_t index, std::function<void()>& task);
+        bool try_steal(size_t index, std::function<void()>& task);
+        void run(size_t index);
+    };
+
+    template <typename F>
+    std::future<std::invoke_result_t<F>> ThreadPool::submit(F&& task)
+    {
+        using Result = std::invoke_result_t<F>;
+
+        // std::function needs a copyable target
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(
+            std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return result;
+    }
+
+}  // namespace sq_config_reader
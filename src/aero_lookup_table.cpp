@@ -0,0 +1,228 @@
+#include <aero_model/aero_lookup_table.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace aero_model
+{
+    namespace
+    {
+        constexpr size_t initial_intervals = 16;
+        constexpr size_t range_samples     = 1025;
+
+        // Interior points per interval used to measure the table error
+        constexpr double check_points[] = {0.25, 0.5, 0.75};
+
+        double max_abs(const UniformLookupTable::Function& f,
+                       double                              x_min,
+                       double                              x_max)
+        {
+            double result = 0.0;
+            double step   = (x_max - x_min) / (range_samples - 1);
+            for (size_t i = 0; i < range_samples; ++i)
+            {
+                result = std::max(result, std::abs(f(x_min + i * step)));
+            }
+            return result;
+        }
+    }  // anonymous namespace
+
+    bool UniformLookupTable::build(const Function& value,
+                                   const Function& slope,
+                                   double          x_min,
+                                   double          x_max,
+                                   size_t          points,
+                                   Interpolation   interpolation)
+    {
+        if (!(x_max > x_min) || points < 2)
+        {
+            std::cerr << "Error: A lookup table needs x_max > x_min and at "
+                      << "least 2 points. Got [" << x_min << ", " << x_max
+                      << "] with " << points << " points." << std::endl;
+            return false;
+        }
+
+        size_t intervals = points - 1;
+        double step      = (x_max - x_min) / static_cast<double>(intervals);
+
+        x_min_         = x_min;
+        x_max_         = x_max;
+        inv_step_      = 1.0 / step;
+        interpolation_ = interpolation;
+        values_.resize(static_cast<Eigen::Index>(points));
+        scaled_slopes_.resize(static_cast<Eigen::Index>(points));
+
+        // Step for central differences when no slope function is given
+        double h = 1e-6 * std::max(1.0, std::max(std::abs(x_min),
+                                                 std::abs(x_max)));
+        for (size_t i = 0; i < points; ++i)
+        {
+            double x   = i == intervals ? x_max : x_min + i * step;
+            values_[i] = value(x);
+            if (interpolation == Interpolation::CubicHermite)
+            {
+                double dydx = slope ? slope(x)
+                                    : (value(x + h) - value(x - h)) / (2 * h);
+                scaled_slopes_[i] = dydx * step;
+            }
+            else
+            {
+                scaled_slopes_[i] = 0.0;
+            }
+        }
+
+        max_error_ = 0.0;
+        for (size_t i = 0; i < intervals; ++i)
+        {
+            for (double t : check_points)
+            {
+                double x     = x_min + (i + t) * step;
+                double error = std::abs((*this)(x) - value(x));
+                max_error_   = std::max(max_error_, error);
+            }
+        }
+        return true;
+    }
+
+    bool UniformLookupTable::build_for_error(const Function& value,
+                                             const Function& slope,
+                                             double          x_min,
+                                             double          x_max,
+                                             double          max_error,
+                                             Interpolation   interpolation,
+                                             size_t          max_points)
+    {
+        size_t intervals = initial_intervals;
+        for (;;)
+        {
+            size_t points = std::min(intervals + 1, max_points);
+            if (!build(value, slope, x_min, x_max, points, interpolation))
+            {
+                return false;
+            }
+            if (max_error_ <= max_error)
+            {
+                return true;
+            }
+            if (points == max_points)
+            {
+                std::cerr << "Error: Lookup table error " << max_error_
+                          << " exceeds the requested bound " << max_error
+                          << " at the maximum size of " << max_points
+                          << " points." << std::endl;
+                return false;
+            }
+            intervals *= 2;
+        }
+    }
+
+    double UniformLookupTable::operator()(double x) const
+    {
+        x = std::min(std::max(x, x_min_), x_max_);
+
+        double position = (x - x_min_) * inv_step_;
+        auto   last     = static_cast<size_t>(values_.size() - 2);
+        size_t i        = std::min(static_cast<size_t>(position), last);
+        double t        = position - static_cast<double>(i);
+
+        double y0 = values_[i];
+        double y1 = values_[i + 1];
+        if (interpolation_ == Interpolation::Linear)
+        {
+            return y0 + t * (y1 - y0);
+        }
+
+        // Cubic Hermite in power form
+        double m0 = scaled_slopes_[i];
+        double m1 = scaled_slopes_[i + 1];
+        double c2 = 3.0 * (y1 - y0) - 2.0 * m0 - m1;
+        double c3 = 2.0 * (y0 - y1) + m0 + m1;
+        return ((c3 * t + c2) * t + m0) * t + y0;
+    }
+
+    bool BSplineAeroLookup::build(const BSplineAeroModel&  model,
+                                  const AeroLookupOptions& options)
+    {
+        const PiecewiseCubic& cx = model.cx_curve();
+        const PiecewiseCubic& cz = model.cz_curve();
+
+        auto value = [](const PiecewiseCubic& curve)
+        { return [&curve](double x) { return curve.value(x); }; };
+        auto slope = [](const PiecewiseCubic& curve)
+        {
+            return [&curve](double x)
+            {
+                double y, dydx;
+                curve.value_and_derivative(x, y, dydx);
+                return dydx;
+            };
+        };
+
+        return cx_.build_for_error(value(cx), slope(cx), options.alpha_min,
+                                   options.alpha_max, options.max_error,
+                                   options.interpolation,
+                                   options.max_points) &&
+               cz_.build_for_error(value(cz), slope(cz), options.alpha_min,
+                                   options.alpha_max, options.max_error,
+                                   options.interpolation, options.max_points);
+    }
+
+    double BSplineAeroLookup::max_error() const
+    {
+        return std::max(cx_.max_error(), cz_.max_error());
+    }
+
+    bool LiftDragAeroLookup::build(const LiftDragAeroModel& model,
+                                   const AeroLookupOptions& options)
+    {
+        double loss = model.config().cl_beta_loss;
+
+        // At zero sideslip the lift loss factor is exactly one
+        UniformLookupTable::Function cl = [&model](double alpha)
+        { return model.evaluate(alpha, 0.0).cl; };
+        UniformLookupTable::Function cd = [&model](double alpha)
+        { return model.evaluate(alpha, 0.0).cd; };
+        UniformLookupTable::Function cl_slope = [&model](double alpha)
+        { return model.evaluate_with_derivatives(alpha, 0.0).d_alpha.cl; };
+        UniformLookupTable::Function cd_slope = [&model](double alpha)
+        { return model.evaluate_with_derivatives(alpha, 0.0).d_alpha.cd; };
+        UniformLookupTable::Function beta_loss = [loss](double beta)
+        {
+            double s = std::sin(beta);
+            return 1.0 - loss * s * s;
+        };
+        UniformLookupTable::Function beta_loss_slope = [loss](double beta)
+        { return -loss * std::sin(2.0 * beta); };
+
+        // Split the CL budget between the two factors of the product
+        max_abs_cl_   = max_abs(cl, options.alpha_min, options.alpha_max);
+        max_abs_loss_ = max_abs(beta_loss, options.beta_min, options.beta_max);
+        double cl_bound =
+            0.5 * options.max_error / std::max(1.0, max_abs_loss_);
+        double loss_bound =
+            0.5 * options.max_error / std::max(1.0, max_abs_cl_);
+
+        cy_beta_ = model.config().cy_beta;
+        return cl_.build_for_error(cl, cl_slope, options.alpha_min,
+                                   options.alpha_max, cl_bound,
+                                   options.interpolation,
+                                   options.max_points) &&
+               cd_.build_for_error(cd, cd_slope, options.alpha_min,
+                                   options.alpha_max, options.max_error,
+                                   options.interpolation,
+                                   options.max_points) &&
+               beta_loss_.build_for_error(beta_loss, beta_loss_slope,
+                                          options.beta_min, options.beta_max,
+                                          loss_bound, options.interpolation,
+                                          options.max_points);
+    }
+
+    double LiftDragAeroLookup::max_error() const
+    {
+        double cl_error =
+            cl_.max_error() * (max_abs_loss_ + beta_loss_.max_error()) +
+            max_abs_cl_ * beta_loss_.max_error();
+        return std::max(cl_error, cd_.max_error());
+    }
+
+}  // namespace aero_model
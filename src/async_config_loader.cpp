@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <sq_config_reader/async_config_loader.hpp>
+#include <sq_config_reader/thread_pool.hpp>
+#include <thread>
+
+namespace sq_config_reader
+{
+    ConfigLoadReport load_configs(
+        const std::vector<ConfigLoadRequest>& requests,
+        size_t                                thread_count)
+    {
+        ConfigLoadReport report;
+        if (requests.empty())
+        {
+            return report;
+        }
+
+        if (thread_count == 0)
+        {
+            size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+            thread_count    = std::min(requests.size(), hardware);
+        }
+
+        std::vector<std::future<bool>> results;
+        results.reserve(requests.size());
+        {
+            ThreadPool pool(thread_count);
+            for (const auto& request : requests)
+            {
+                results.push_back(pool.submit(
+                    [reader = request.reader, id = request.id]()
+                    { return reader->access_and_fetch_data(id); }));
+            }
+        }
+
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            const auto& request = requests[i];
+            std::string context = request.reader->get_table_name() + " (id " +
+                                  std::to_string(request.id) + ")";
+            try
+            {
+                if (!results[i].get())
+                {
+                    report.errors.push_back(context + ": failed to load");
+                }
+            }
+            catch (const std::exception& e)
+            {
+                report.errors.push_back(context + ": " + e.what());
+            }
+        }
+
+        return report;
+    }
+
+}  // namespace sq_config_reader
@@ -0,0 +1,95 @@
+// Compares the vector-based use of PhiAeroConfigReader (filling a matrix
+// from get_phi() for every vector) with aero_model::apply_phi over the same
+// vectors.
+//
+//   benchmark_phi [id] [vectors] [repeats]
+#include <Eigen/Core>
+#include <aero_model/phi_aero_model.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sq_config_reader/phi_aero_config_reader.hpp>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ns_per_vector(Clock::duration elapsed, size_t vectors)
+    {
+        return std::chrono::duration<double, std::nano>(elapsed).count() /
+               static_cast<double>(vectors);
+    }
+}  // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int    id      = argc > 1 ? std::atoi(argv[1]) : 1;
+    size_t n       = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 500;
+    size_t repeats = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 2000;
+
+    sq_config_reader::PhiAeroConfigReader reader;
+    if (!reader.access_and_fetch_data(id))
+    {
+        std::cerr << "Error: Failed to load phi_aero_config id " << id
+                  << std::endl;
+        return 1;
+    }
+
+    std::mt19937                           rng(42);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<double>                    in(3 * n);
+    for (auto& value : in)
+    {
+        value = uniform(rng);
+    }
+    std::vector<double> copied(3 * n), batched(3 * n);
+
+    // Current usage: fill a matrix from get_phi() for every vector
+    auto begin = Clock::now();
+    for (size_t r = 0; r < repeats; ++r)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const std::vector<double>& phi = reader.get_phi();
+            Eigen::Matrix3d            matrix;
+            for (int row = 0; row < 3; ++row)
+            {
+                for (int col = 0; col < 3; ++col)
+                {
+                    matrix(row, col) = phi[3 * row + col];
+                }
+            }
+            Eigen::Map<Eigen::Vector3d>(copied.data() + 3 * i) =
+                matrix * Eigen::Map<const Eigen::Vector3d>(in.data() + 3 * i);
+        }
+    }
+    auto copy_time = Clock::now() - begin;
+
+    begin = Clock::now();
+    for (size_t r = 0; r < repeats; ++r)
+    {
+        aero_model::apply_phi(reader.get_phi_matrix(), in.data(),
+                              batched.data(), n);
+    }
+    auto batch_time = Clock::now() - begin;
+
+    double max_difference = 0.0;
+    for (size_t i = 0; i < 3 * n; ++i)
+    {
+        max_difference =
+            std::max(max_difference, std::abs(copied[i] - batched[i]));
+    }
+
+    size_t total = n * repeats;
+    std::cout << "vectors: " << n << " x " << repeats << " repeats\n"
+              << "copy per vector: " << ns_per_vector(copy_time, total)
+              << " ns/vector\n"
+              << "apply_phi:       " << ns_per_vector(batch_time, total)
+              << " ns/vector\n"
+              << "max difference:  " << max_difference << std::endl;
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include <aero_model/bspline_aero_model.hpp>
+#include <iostream>
+
+namespace aero_model
+{
+    bool BSplineAeroModel::build(
+        const sq_config_reader::BSplineAeroConfig& config)
+    {
+        if (!cx_.build(config.cx_knots, config.cx_coefs))
+        {
+            std::cerr << "Failed to build the cx B-spline" << std::endl;
+            return false;
+        }
+        if (!cz_.build(config.cz_knots, config.cz_coefs))
+        {
+            std::cerr << "Failed to build the cz B-spline" << std::endl;
+            return false;
+        }
+        scale_factor_ = config.scale_factor;
+        return true;
+    }
+
+    BSplineAeroCoefficients BSplineAeroModel::evaluate(double alpha) const
+    {
+        BSplineAeroCoefficients result;
+        cx_.value_and_derivative(alpha, result.cx, result.dcx_dalpha);
+        cz_.value_and_derivative(alpha, result.cz, result.dcz_dalpha);
+        return result;
+    }
+
+    void BSplineAeroModel::evaluate(const double* alpha,
+                                    double*       cx,
+                                    double*       cz,
+                                    double*       dcx_dalpha,
+                                    double*       dcz_dalpha,
+                                    size_t        n) const
+    {
+        cx_.evaluate(alpha, cx, dcx_dalpha, n);
+        cz_.evaluate(alpha, cz, dcz_dalpha, n);
+    }
+
+}  // namespace aero_model
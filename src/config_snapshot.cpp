@@ -0,0 +1,340 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>  // For std::rename
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sq_config_reader/config_snapshot.hpp>
+#include <thread>
+#include <unordered_map>
+
+#include "fnv1a.hpp"
+
+namespace sq_config_reader
+{
+    namespace
+    {
+        constexpr char          SNAPSHOT_MAGIC[8] = {'S', 'Q', 'C', 'S',
+                                                     'N', 'A', 'P', '\0'};
+        constexpr std::uint32_t SNAPSHOT_VERSION  = 1;
+        constexpr size_t        SNAPSHOT_ALIGN    = 64;
+
+        using detail::fnv1a;
+        using detail::FNV_OFFSET_BASIS;
+        using detail::FNV_PRIME;
+
+        struct alignas(SNAPSHOT_ALIGN) SnapshotHeader
+        {
+            char          magic[8];
+            std::uint32_t version;
+            std::uint32_t field_count;
+            DatabaseKey   key;
+            std::uint64_t table_hash;
+            std::int64_t  id;
+            std::uint64_t payload_checksum;
+            std::uint64_t total_size;
+        };
+
+        struct SnapshotFieldEntry
+        {
+            std::uint64_t offset;  // From the start of the file, in bytes
+            std::uint64_t size;    // Number of doubles
+        };
+
+        size_t align_up(size_t value)
+        {
+            return (value + SNAPSHOT_ALIGN - 1) & ~(SNAPSHOT_ALIGN - 1);
+        }
+
+        // Word-at-a-time hash for whole files; FNV-1a per byte would make the
+        // key check cost comparable to the SQLite load it replaces.
+        std::uint64_t hash_words(std::uint64_t hash,
+                                 const void*   data,
+                                 size_t        size)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            size_t      words = size / sizeof(std::uint64_t);
+            for (size_t i = 0; i < words; ++i)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, bytes + i * sizeof(word), sizeof(word));
+                hash ^= word;
+                hash *= FNV_PRIME;
+                hash ^= hash >> 29;
+            }
+            return fnv1a(hash, bytes + words * sizeof(std::uint64_t),
+                         size % sizeof(std::uint64_t));
+        }
+
+        std::int64_t mtime_ns(const struct stat& st)
+        {
+            return static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000 +
+                   st.st_mtim.tv_nsec;
+        }
+
+        // Hashes the file content; a missing file hashes as empty.
+        bool hash_file(const std::string& path,
+                       std::uint64_t&     size,
+                       std::int64_t&      mtime,
+                       std::uint64_t&     hash)
+        {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                size  = 0;
+                mtime = 0;
+                return errno == ENOENT;
+            }
+
+            struct stat st;
+            if (fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+            size  = static_cast<std::uint64_t>(st.st_size);
+            mtime = mtime_ns(st);
+
+            if (size > 0)
+            {
+                void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED)
+                {
+                    ::close(fd);
+                    return false;
+                }
+                hash = hash_words(hash, data, size);
+                munmap(data, size);
+            }
+            ::close(fd);
+            return true;
+        }
+    }  // anonymous namespace
+
+    ConfigSnapshot::~ConfigSnapshot()
+    {
+        if (mapping_)
+        {
+            munmap(mapping_, mapping_size_);
+        }
+    }
+
+    std::string ConfigSnapshot::path_for(const std::string& db_file,
+                                         const std::string& table_name,
+                                         int                id)
+    {
+        return db_file + "." + table_name + "." + std::to_string(id) + ".snap";
+    }
+
+    bool ConfigSnapshot::can_write(const std::string& db_file)
+    {
+        static std::mutex                            mutex;
+        static std::unordered_map<std::string, bool> writable;
+
+        std::string directory =
+            std::filesystem::path(db_file).parent_path().string();
+        if (directory.empty())
+        {
+            directory = ".";
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        found = writable.find(directory);
+        if (found == writable.end())
+        {
+            found = writable
+                        .emplace(directory,
+                                 access(directory.c_str(), W_OK) == 0)
+                        .first;
+        }
+        return found->second;
+    }
+
+    bool ConfigSnapshot::read_database_key(const std::string& db_file,
+                                           DatabaseKey&       key)
+    {
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        if (!hash_file(db_file, key.db_size, key.db_mtime_ns, hash) ||
+            !hash_file(db_file + "-wal", key.wal_size, key.wal_mtime_ns, hash))
+        {
+            return false;
+        }
+        key.content_hash = hash;
+        return true;
+    }
+
+    bool ConfigSnapshot::open(const std::string& db_file,
+                              const std::string& table_name,
+                              int                id)
+    {
+        std::string path = path_for(db_file, table_name, id);
+        int         fd   = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 ||
+            static_cast<size_t>(st.st_size) < sizeof(SnapshotHeader))
+        {
+            ::close(fd);
+            return false;
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+        void*  data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+        mapping_      = data;
+        mapping_size_ = size;
+
+        const auto* base   = static_cast<const unsigned char*>(data);
+        const auto* header = static_cast<const SnapshotHeader*>(data);
+
+        DatabaseKey key;
+        if (std::memcmp(header->magic, SNAPSHOT_MAGIC,
+                        sizeof(SNAPSHOT_MAGIC)) != 0 ||
+            header->version != SNAPSHOT_VERSION ||
+            header->total_size != size || header->id != id ||
+            header->table_hash !=
+                fnv1a(FNV_OFFSET_BASIS, table_name.data(), table_name.size()) ||
+            !read_database_key(db_file, key) || header->key != key)
+        {
+            return false;
+        }
+
+        size_t table_end = sizeof(SnapshotHeader) +
+                           header->field_count * sizeof(SnapshotFieldEntry);
+        if (table_end > size)
+        {
+            return false;
+        }
+
+        const auto* entries = reinterpret_cast<const SnapshotFieldEntry*>(
+            base + sizeof(SnapshotHeader));
+        std::uint64_t checksum = FNV_OFFSET_BASIS;
+        fields_.clear();
+        fields_.reserve(header->field_count);
+        for (std::uint32_t i = 0; i < header->field_count; ++i)
+        {
+            const SnapshotFieldEntry& entry = entries[i];
+            if (entry.offset % SNAPSHOT_ALIGN != 0 || entry.offset > size ||
+                entry.size > (size - entry.offset) / sizeof(double))
+            {
+                fields_.clear();
+                return false;
+            }
+            const auto* values =
+                reinterpret_cast<const double*>(base + entry.offset);
+            checksum =
+                hash_words(checksum, values, entry.size * sizeof(double));
+            fields_.push_back({values, static_cast<size_t>(entry.size)});
+        }
+
+        if (checksum != header->payload_checksum)
+        {
+            fields_.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool ConfigSnapshot::write(const std::string&                db_file,
+                               const std::string&                table_name,
+                               int                               id,
+                               const DatabaseKey&                key,
+                               const std::vector<SnapshotField>& fields)
+    {
+        std::vector<SnapshotFieldEntry> entries(fields.size());
+        size_t offset = align_up(sizeof(SnapshotHeader) +
+                                 fields.size() * sizeof(SnapshotFieldEntry));
+        std::uint64_t checksum = FNV_OFFSET_BASIS;
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            entries[i] = {offset, fields[i].size};
+            offset     = align_up(offset + fields[i].size * sizeof(double));
+            checksum   = hash_words(checksum, fields[i].data,
+                                    fields[i].size * sizeof(double));
+        }
+
+        std::vector<unsigned char> buffer(offset, 0);
+        SnapshotHeader             header{};
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        header.version     = SNAPSHOT_VERSION;
+        header.field_count = static_cast<std::uint32_t>(fields.size());
+        header.key         = key;
+        header.table_hash =
+            fnv1a(FNV_OFFSET_BASIS, table_name.data(), table_name.size());
+        header.id               = id;
+        header.payload_checksum = checksum;
+        header.total_size       = offset;
+
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        std::memcpy(buffer.data() + sizeof(header), entries.data(),
+                    entries.size() * sizeof(SnapshotFieldEntry));
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            std::memcpy(buffer.data() + entries[i].offset, fields[i].data,
+                        fields[i].size * sizeof(double));
+        }
+
+        // Unique per process and thread, so concurrent writers never share a
+        // temporary file; the final rename is atomic.
+        std::string path = path_for(db_file, table_name, id);
+        std::string tmp_path =
+            path + ".tmp." + std::to_string(getpid()) + "." +
+            std::to_string(std::hash<std::thread::id>{}(
+                std::this_thread::get_id()));
+
+        int fd = ::open(tmp_path.c_str(),
+                        O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            std::cerr << "Failed to create snapshot " << tmp_path << ": "
+                      << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        const unsigned char* cursor    = buffer.data();
+        size_t               remaining = buffer.size();
+        while (remaining > 0)
+        {
+            ssize_t written = ::write(fd, cursor, remaining);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                std::cerr << "Failed to write snapshot " << tmp_path << ": "
+                          << std::strerror(errno) << std::endl;
+                ::close(fd);
+                unlink(tmp_path.c_str());
+                return false;
+            }
+            cursor += written;
+            remaining -= static_cast<size_t>(written);
+        }
+        ::close(fd);
+
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        {
+            std::cerr << "Failed to publish snapshot " << path << ": "
+                      << std::strerror(errno) << std::endl;
+            unlink(tmp_path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+}  // namespace sq_config_reader
@@ -0,0 +1,271 @@
+#include <poll.h>
+#include <sqlite3.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>  // For std::getenv
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sq_config_reader/config_watcher.hpp>
+#include <stdexcept>
+
+#include "fnv1a.hpp"
+
+namespace sq_config_reader
+{
+    namespace
+    {
+        constexpr const char* DB_FILENAME     = "aero_sim_params.db";
+        constexpr int         BUSY_TIMEOUT_MS = 200;
+
+        using detail::fnv1a;
+        using detail::FNV_OFFSET_BASIS;
+
+        // SQLite touches the database, its journal and its WAL file; other
+        // files next to it (e.g. snapshots) are ignored.
+        bool is_database_event(const char* name, const std::string& db_name)
+        {
+            if (std::strncmp(name, db_name.c_str(), db_name.size()) != 0)
+            {
+                return false;
+            }
+            const char* suffix = name + db_name.size();
+            return *suffix == '\0' || std::strcmp(suffix, "-wal") == 0 ||
+                   std::strcmp(suffix, "-journal") == 0;
+        }
+    }  // anonymous namespace
+
+    ConfigWatcher::ConfigWatcher() : db_name_(DB_FILENAME)
+    {
+        const char* AERO_SIM_DATA_DIR = std::getenv("AERO_SIM_DATA_DIR");
+        if (!AERO_SIM_DATA_DIR)
+        {
+            throw std::runtime_error(
+                "AERO_SIM_DATA_DIR environment variable is not set.");
+        }
+
+        db_dir_  = AERO_SIM_DATA_DIR;
+        db_file_ = db_dir_ + "/" + db_name_;
+
+        if (!std::filesystem::exists(db_file_))
+        {
+            throw std::runtime_error("Database file " + db_file_ +
+                                     " does not exist.");
+        }
+    }
+
+    ConfigWatcher::~ConfigWatcher() { stop(); }
+
+    bool ConfigWatcher::start()
+    {
+        if (running_)
+        {
+            return true;
+        }
+
+        inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotify_fd_ < 0)
+        {
+            std::cerr << "Failed to initialize inotify: "
+                      << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        // Watch the directory rather than the file: tools that rewrite the
+        // database by renaming a new file over it would drop a file watch.
+        if (inotify_add_watch(inotify_fd_, db_dir_.c_str(),
+                              IN_MODIFY | IN_MOVED_TO | IN_CREATE) < 0)
+        {
+            std::cerr << "Failed to watch " << db_dir_ << ": "
+                      << std::strerror(errno) << std::endl;
+            close(inotify_fd_);
+            inotify_fd_ = -1;
+            return false;
+        }
+
+        stop_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (stop_fd_ < 0)
+        {
+            std::cerr << "Failed to create eventfd: " << std::strerror(errno)
+                      << std::endl;
+            close(inotify_fd_);
+            inotify_fd_ = -1;
+            return false;
+        }
+
+        running_ = true;
+        thread_  = std::thread(&ConfigWatcher::run, this);
+        return true;
+    }
+
+    void ConfigWatcher::stop()
+    {
+        if (!running_)
+        {
+            return;
+        }
+
+        running_             = false;
+        std::uint64_t signal = 1;
+        if (write(stop_fd_, &signal, sizeof(signal)) < 0)
+        {
+            std::cerr << "Failed to signal watcher thread: "
+                      << std::strerror(errno) << std::endl;
+        }
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+
+        close(stop_fd_);
+        close(inotify_fd_);
+        stop_fd_    = -1;
+        inotify_fd_ = -1;
+    }
+
+    void ConfigWatcher::add_entry(Entry entry)
+    {
+        std::lock_guard<std::mutex> lock(entries_mutex_);
+        entries_.push_back(std::move(entry));
+    }
+
+    bool ConfigWatcher::row_fingerprint(const std::string& table_name,
+                                        int                id,
+                                        std::uint64_t&     fingerprint) const
+    {
+        sqlite3* db = nullptr;
+        if (sqlite3_open_v2(db_file_.c_str(), &db, SQLITE_OPEN_READONLY,
+                            nullptr) != SQLITE_OK)
+        {
+            std::cerr << "Can't open database: " << sqlite3_errmsg(db)
+                      << std::endl;
+            sqlite3_close(db);
+            return false;
+        }
+        sqlite3_busy_timeout(db, BUSY_TIMEOUT_MS);
+
+        std::string   sql  = "SELECT * FROM " + table_name + " WHERE id = ?";
+        sqlite3_stmt* stmt = nullptr;
+        bool          ok   = false;
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) ==
+                SQLITE_OK &&
+            sqlite3_bind_int(stmt, 1, id) == SQLITE_OK)
+        {
+            int rc      = sqlite3_step(stmt);
+            fingerprint = FNV_OFFSET_BASIS;
+            if (rc == SQLITE_ROW)
+            {
+                int columns = sqlite3_column_count(stmt);
+                for (int i = 0; i < columns; ++i)
+                {
+                    const unsigned char* text = sqlite3_column_text(stmt, i);
+                    int                  size = sqlite3_column_bytes(stmt, i);
+                    fingerprint = fnv1a(fingerprint, &size, sizeof(size));
+                    if (text)
+                    {
+                        fingerprint = fnv1a(fingerprint, text, size);
+                    }
+                }
+                ok = true;
+            }
+            else if (rc == SQLITE_DONE)
+            {
+                // A deleted row fingerprints as empty; reloading it will fail
+                // and the last good version stays published.
+                ok = true;
+            }
+        }
+
+        if (!ok)
+        {
+            std::cerr << "Failed to read " << table_name << " (id " << id
+                      << "): " << sqlite3_errmsg(db) << std::endl;
+        }
+
+        sqlite3_finalize(stmt);
+        sqlite3_close(db);
+        return ok;
+    }
+
+    void ConfigWatcher::reload_changed()
+    {
+        std::lock_guard<std::mutex> lock(entries_mutex_);
+        for (auto& entry : entries_)
+        {
+            std::uint64_t fingerprint = 0;
+            if (!row_fingerprint(entry.table_name, entry.id, fingerprint) ||
+                fingerprint == entry.fingerprint)
+            {
+                continue;
+            }
+
+            // A rejected row is remembered too, so it is not retried until
+            // its content changes again.
+            entry.fingerprint = fingerprint;
+            if (!entry.reload())
+            {
+                std::cerr << "Rejected reload of " << entry.table_name
+                          << " (id " << entry.id
+                          << "), keeping the previous configuration"
+                          << std::endl;
+            }
+        }
+    }
+
+    void ConfigWatcher::run()
+    {
+        alignas(struct inotify_event) char buffer[4096];
+        bool pending = false;
+
+        pollfd fds[2] = {{inotify_fd_, POLLIN, 0}, {stop_fd_, POLLIN, 0}};
+        while (running_)
+        {
+            int ready = poll(fds, 2, pending ? debounce_ms_ : -1);
+            if (ready < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                std::cerr << "Watcher poll failed: " << std::strerror(errno)
+                          << std::endl;
+                break;
+            }
+
+            if (fds[1].revents & POLLIN)
+            {
+                break;
+            }
+
+            if (ready == 0)
+            {
+                pending = false;
+                reload_changed();
+                continue;
+            }
+
+            if (fds[0].revents & POLLIN)
+            {
+                ssize_t length;
+                while ((length = read(inotify_fd_, buffer, sizeof(buffer))) >
+                       0)
+                {
+                    for (char* ptr = buffer; ptr < buffer + length;)
+                    {
+                        auto* event = reinterpret_cast<inotify_event*>(ptr);
+                        if (event->len > 0 &&
+                            is_database_event(event->name, db_name_))
+                        {
+                            pending = true;
+                        }
+                        ptr += sizeof(inotify_event) + event->len;
+                    }
+                }
+            }
+        }
+    }
+
+}  // namespace sq_config_reader
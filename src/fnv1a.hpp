@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Internal to the config reader sources; not installed.
+namespace sq_config_reader
+{
+    namespace detail
+    {
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        constexpr std::uint64_t FNV_PRIME        = 1099511628211ull;
+
+        inline std::uint64_t fnv1a(std::uint64_t hash,
+                                   const void*   data,
+                                   size_t        size)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+            return hash;
+        }
+    }  // namespace detail
+}  // namespace sq_config_reader
@@ -0,0 +1,225 @@
+#include <Eigen/Core>
+#include <aero_model/lift_drag_aero_model.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace aero_model
+{
+    namespace
+    {
+        constexpr size_t batch_size = 64;
+        constexpr double pi         = 3.14159265358979323846;
+
+        using Batch    = Eigen::Array<double, batch_size, 1>;
+        using ConstMap = Eigen::Map<const Eigen::ArrayXd>;
+        using Map      = Eigen::Map<Eigen::ArrayXd>;
+    }  // anonymous namespace
+
+    bool LiftDragAeroModel::build(
+        const sq_config_reader::AdvancedLiftDragConfig& config)
+    {
+        if (!(config.eff > 0.0))
+        {
+            std::cerr << "Error: eff must be positive, but got " << config.eff
+                      << std::endl;
+            return false;
+        }
+        if (!(config.sigmoid_blend >= 0.0))
+        {
+            std::cerr << "Error: sigmoid_blend must be non-negative, but got "
+                      << config.sigmoid_blend << std::endl;
+            return false;
+        }
+
+        config_     = config;
+        inv_pi_eff_ = 1.0 / (pi * config.eff);
+        return true;
+    }
+
+    LiftDragCoefficients LiftDragAeroModel::evaluate(double alpha,
+                                                     double beta) const
+    {
+        const auto& c = config_;
+
+        double s1 =
+            1.0 / (1.0 + std::exp(c.sigmoid_blend * (alpha - c.alpha_stall)));
+        double s2 =
+            1.0 / (1.0 + std::exp(-c.sigmoid_blend * (alpha + c.alpha_stall)));
+        double sigma = 1.0 - s1 * s2;
+
+        double sin_a = std::sin(alpha);
+        double cos_a = std::cos(alpha);
+        double sin_b = std::sin(beta);
+
+        double cl_pre  = c.cl_alpha_0 + c.cl_alpha * alpha;
+        double cl_post = 2.0 * sin_a * std::abs(sin_a) * cos_a;
+        double cd_pre  = c.cd_0 + cl_pre * cl_pre * inv_pi_eff_;
+        double cd_post = c.cd_flat_plate * sin_a * sin_a;
+
+        LiftDragCoefficients result;
+        result.cl = ((1.0 - sigma) * cl_pre + sigma * cl_post) *
+                    (1.0 - c.cl_beta_loss * sin_b * sin_b);
+        result.cd = (1.0 - sigma) * cd_pre + sigma * cd_post;
+        result.cy = c.cy_beta * beta;
+        return result;
+    }
+
+    LiftDragDerivatives LiftDragAeroModel::evaluate_with_derivatives(
+        double alpha,
+        double beta) const
+    {
+        const auto& c = config_;
+
+        double s1 =
+            1.0 / (1.0 + std::exp(c.sigmoid_blend * (alpha - c.alpha_stall)));
+        double s2 =
+            1.0 / (1.0 + std::exp(-c.sigmoid_blend * (alpha + c.alpha_stall)));
+        double sigma   = 1.0 - s1 * s2;
+        double d_sigma = c.sigmoid_blend * s1 * s2 * (s2 - s1);
+
+        double sin_a = std::sin(alpha);
+        double cos_a = std::cos(alpha);
+        double sin_b = std::sin(beta);
+        double cos_b = std::cos(beta);
+
+        double cl_pre    = c.cl_alpha_0 + c.cl_alpha * alpha;
+        double cl_post   = 2.0 * sin_a * std::abs(sin_a) * cos_a;
+        double d_cl_post =
+            2.0 * std::abs(sin_a) * (2.0 * cos_a * cos_a - sin_a * sin_a);
+        double cd_pre    = c.cd_0 + cl_pre * cl_pre * inv_pi_eff_;
+        double d_cd_pre  = 2.0 * cl_pre * c.cl_alpha * inv_pi_eff_;
+        double cd_post   = c.cd_flat_plate * sin_a * sin_a;
+        double d_cd_post = 2.0 * c.cd_flat_plate * sin_a * cos_a;
+
+        double cl_alpha_only   = (1.0 - sigma) * cl_pre + sigma * cl_post;
+        double d_cl_alpha_only = (1.0 - sigma) * c.cl_alpha +
+                                 sigma * d_cl_post +
+                                 d_sigma * (cl_post - cl_pre);
+        double beta_loss   = 1.0 - c.cl_beta_loss * sin_b * sin_b;
+        double d_beta_loss = -2.0 * c.cl_beta_loss * sin_b * cos_b;
+
+        LiftDragDerivatives result;
+        result.value.cl   = cl_alpha_only * beta_loss;
+        result.value.cd   = (1.0 - sigma) * cd_pre + sigma * cd_post;
+        result.value.cy   = c.cy_beta * beta;
+        result.d_alpha.cl = d_cl_alpha_only * beta_loss;
+        result.d_alpha.cd = (1.0 - sigma) * d_cd_pre + sigma * d_cd_post +
+                            d_sigma * (cd_post - cd_pre);
+        result.d_alpha.cy = 0.0;
+        result.d_beta.cl  = cl_alpha_only * d_beta_loss;
+        result.d_beta.cd  = 0.0;
+        result.d_beta.cy  = c.cy_beta;
+        return result;
+    }
+
+    void LiftDragAeroModel::evaluate(const LiftDragBatch& batch,
+                                     size_t               n) const
+    {
+        const auto& c = config_;
+
+        bool want_forces = batch.lift || batch.drag || batch.side;
+        bool want_alpha_derivatives = batch.dcl_dalpha || batch.dcd_dalpha;
+
+        Batch s1, s2, sigma, sin_a, cos_a, sin_b, cl_pre, cl_alpha_only,
+            beta_loss, cl, cd, q, d_sigma;
+        for (size_t begin = 0; begin < n; begin += batch_size)
+        {
+            size_t   m = std::min(batch_size, n - begin);
+            ConstMap alpha(batch.alpha + begin, m);
+            ConstMap beta(batch.beta + begin, m);
+
+            s1.head(m) =
+                1.0 / (1.0 + (c.sigmoid_blend * (alpha - c.alpha_stall)).exp());
+            s2.head(m) =
+                1.0 /
+                (1.0 + (-c.sigmoid_blend * (alpha + c.alpha_stall)).exp());
+            sigma.head(m) = 1.0 - s1.head(m) * s2.head(m);
+
+            sin_a.head(m)  = alpha.sin();
+            cos_a.head(m)  = alpha.cos();
+            sin_b.head(m)  = beta.sin();
+            cl_pre.head(m) = c.cl_alpha_0 + c.cl_alpha * alpha;
+
+            cl_alpha_only.head(m) =
+                (1.0 - sigma.head(m)) * cl_pre.head(m) +
+                sigma.head(m) * 2.0 * sin_a.head(m) * sin_a.head(m).abs() *
+                    cos_a.head(m);
+            beta_loss.head(m) = 1.0 - c.cl_beta_loss * sin_b.head(m).square();
+            cl.head(m)        = cl_alpha_only.head(m) * beta_loss.head(m);
+            cd.head(m) =
+                (1.0 - sigma.head(m)) *
+                    (c.cd_0 + cl_pre.head(m).square() * inv_pi_eff_) +
+                sigma.head(m) * c.cd_flat_plate * sin_a.head(m).square();
+
+            if (batch.cl)
+            {
+                Map(batch.cl + begin, m) = cl.head(m);
+            }
+            if (batch.cd)
+            {
+                Map(batch.cd + begin, m) = cd.head(m);
+            }
+            if (batch.cy)
+            {
+                Map(batch.cy + begin, m) = c.cy_beta * beta;
+            }
+
+            if (want_alpha_derivatives)
+            {
+                d_sigma.head(m) = c.sigmoid_blend * s1.head(m) * s2.head(m) *
+                                  (s2.head(m) - s1.head(m));
+            }
+            if (batch.dcl_dalpha)
+            {
+                Map(batch.dcl_dalpha + begin, m) =
+                    ((1.0 - sigma.head(m)) * c.cl_alpha +
+                     sigma.head(m) * 2.0 * sin_a.head(m).abs() *
+                         (2.0 * cos_a.head(m).square() -
+                          sin_a.head(m).square()) +
+                     d_sigma.head(m) *
+                         (2.0 * sin_a.head(m) * sin_a.head(m).abs() *
+                              cos_a.head(m) -
+                          cl_pre.head(m))) *
+                    beta_loss.head(m);
+            }
+            if (batch.dcl_dbeta)
+            {
+                Map(batch.dcl_dbeta + begin, m) =
+                    -2.0 * c.cl_beta_loss * cl_alpha_only.head(m) *
+                    sin_b.head(m) * beta.cos();
+            }
+            if (batch.dcd_dalpha)
+            {
+                Map(batch.dcd_dalpha + begin, m) =
+                    (1.0 - sigma.head(m)) * 2.0 * c.cl_alpha *
+                        inv_pi_eff_ * cl_pre.head(m) +
+                    sigma.head(m) * 2.0 * c.cd_flat_plate * sin_a.head(m) *
+                        cos_a.head(m) +
+                    d_sigma.head(m) *
+                        (c.cd_flat_plate * sin_a.head(m).square() - c.cd_0 -
+                         cl_pre.head(m).square() * inv_pi_eff_);
+            }
+
+            if (want_forces)
+            {
+                ConstMap airspeed(batch.airspeed + begin, m);
+                q.head(m) = c.scale_factor * airspeed.square();
+                if (batch.lift)
+                {
+                    Map(batch.lift + begin, m) = cl.head(m) * q.head(m);
+                }
+                if (batch.drag)
+                {
+                    Map(batch.drag + begin, m) = cd.head(m) * q.head(m);
+                }
+                if (batch.side)
+                {
+                    Map(batch.side + begin, m) =
+                        c.cy_beta * beta * q.head(m);
+                }
+            }
+        }
+    }
+
+}  // namespace aero_model
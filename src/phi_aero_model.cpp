@@ -0,0 +1,22 @@
+#include <aero_model/phi_aero_model.hpp>
+
+namespace aero_model
+{
+    void apply_phi(const Eigen::Matrix3d& phi,
+                   const double*          in,
+                   double*                out,
+                   size_t                 n)
+    {
+        const auto cols = static_cast<Eigen::Index>(n);
+        Eigen::Map<Eigen::Matrix3Xd>(out, 3, cols).noalias() =
+            phi * Eigen::Map<const Eigen::Matrix3Xd>(in, 3, cols);
+    }
+
+    void apply_phi(const Eigen::Matrix3d&                    phi,
+                   const Eigen::Ref<const Eigen::Matrix3Xd>& in,
+                   Eigen::Ref<Eigen::Matrix3Xd>              out)
+    {
+        out.noalias() = phi * in;
+    }
+
+}  // namespace aero_model
@@ -0,0 +1,217 @@
+#include <Eigen/Core>
+#include <aero_model/piecewise_cubic.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace aero_model
+{
+    namespace
+    {
+        constexpr int    degree            = 3;
+        constexpr size_t batch_size        = 64;
+        constexpr double uniform_tolerance = 1e-9;
+
+        // De Boor's algorithm on a fixed knot span. Evaluating the span's
+        // polynomial at any x (also outside the span) is what lets us sample
+        // it for the power-basis conversion.
+        double de_boor(const std::vector<double>& knots,
+                       const std::vector<double>& coefs,
+                       size_t                     span,
+                       double                     x)
+        {
+            double d[degree + 1];
+            for (int j = 0; j <= degree; ++j)
+            {
+                d[j] = coefs[span - degree + j];
+            }
+
+            for (int r = 1; r <= degree; ++r)
+            {
+                for (int j = degree; j >= r; --j)
+                {
+                    double left  = knots[span - degree + j];
+                    double right = knots[span + 1 + j - r];
+                    double alpha = (x - left) / (right - left);
+                    d[j]         = (1.0 - alpha) * d[j - 1] + alpha * d[j];
+                }
+            }
+            return d[degree];
+        }
+
+        using Batch = Eigen::Array<double, batch_size, 1>;
+    }  // anonymous namespace
+
+    bool PiecewiseCubic::build(const std::vector<double>& knots,
+                               const std::vector<double>& coefs)
+    {
+        if (coefs.size() < degree + 1 ||
+            knots.size() != coefs.size() + degree + 1)
+        {
+            std::cerr << "Error: A cubic B-spline needs at least "
+                      << degree + 1 << " coefficients and "
+                      << "knots.size() == coefs.size() + " << degree + 1
+                      << ". Got knots: " << knots.size()
+                      << ", coefs: " << coefs.size() << std::endl;
+            return false;
+        }
+        if (!std::is_sorted(knots.begin(), knots.end()))
+        {
+            std::cerr << "Error: B-spline knots must be non-decreasing."
+                      << std::endl;
+            return false;
+        }
+
+        breaks_.clear();
+        inv_width_.clear();
+        c0_.clear();
+        c1_.clear();
+        c2_.clear();
+        c3_.clear();
+
+        // Valid spans are [knots[degree], knots[n]]; repeated knots give
+        // empty intervals, which are dropped.
+        for (size_t span = degree; span < coefs.size(); ++span)
+        {
+            double left  = knots[span];
+            double right = knots[span + 1];
+            if (!(right > left))
+            {
+                continue;
+            }
+
+            // Sample at s = 0, 1/3, 2/3, 1 and convert the Newton forward
+            // differences to power-basis coefficients in s.
+            double third = (right - left) / 3.0;
+            double p0    = de_boor(knots, coefs, span, left);
+            double p1    = de_boor(knots, coefs, span, left + third);
+            double p2    = de_boor(knots, coefs, span, left + 2.0 * third);
+            double p3    = de_boor(knots, coefs, span, right);
+
+            double d1 = p1 - p0;
+            double d2 = p2 - 2.0 * p1 + p0;
+            double d3 = p3 - 3.0 * p2 + 3.0 * p1 - p0;
+
+            if (breaks_.empty())
+            {
+                breaks_.push_back(left);
+            }
+            breaks_.push_back(right);
+            inv_width_.push_back(1.0 / (right - left));
+            c0_.push_back(p0);
+            c1_.push_back(3.0 * (d1 - 0.5 * d2 + d3 / 3.0));
+            c2_.push_back(4.5 * (d2 - d3));
+            c3_.push_back(4.5 * d3);
+        }
+
+        if (c0_.empty())
+        {
+            std::cerr << "Error: B-spline has no non-empty knot interval."
+                      << std::endl;
+            return false;
+        }
+
+        double step = (breaks_.back() - breaks_.front()) /
+                      static_cast<double>(interval_count());
+        uniform_    = true;
+        for (size_t i = 0; i < interval_count(); ++i)
+        {
+            double width = breaks_[i + 1] - breaks_[i];
+            if (std::abs(width - step) > uniform_tolerance * step)
+            {
+                uniform_ = false;
+                break;
+            }
+        }
+        origin_   = breaks_.front();
+        inv_step_ = 1.0 / step;
+
+        return true;
+    }
+
+    size_t PiecewiseCubic::find_interval(double x) const
+    {
+        size_t last = interval_count() - 1;
+        if (uniform_)
+        {
+            double position = (x - origin_) * inv_step_;
+            if (!(position > 0.0))
+            {
+                return 0;
+            }
+            if (position >= static_cast<double>(last))
+            {
+                return last;
+            }
+            return static_cast<size_t>(position);
+        }
+
+        // Largest i in [0, last] with breaks_[i] <= x, without a
+        // data-dependent branch in the loop body.
+        const double* base  = breaks_.data();
+        size_t        count = last + 1;
+        while (count > 1)
+        {
+            size_t half = count / 2;
+            base        = (base[half] <= x) ? base + half : base;
+            count -= half;
+        }
+        return static_cast<size_t>(base - breaks_.data());
+    }
+
+    double PiecewiseCubic::value(double x) const
+    {
+        size_t i = find_interval(x);
+        double s = (x - breaks_[i]) * inv_width_[i];
+        return ((c3_[i] * s + c2_[i]) * s + c1_[i]) * s + c0_[i];
+    }
+
+    void PiecewiseCubic::value_and_derivative(double  x,
+                                              double& value,
+                                              double& derivative) const
+    {
+        size_t i = find_interval(x);
+        double s = (x - breaks_[i]) * inv_width_[i];
+        value    = ((c3_[i] * s + c2_[i]) * s + c1_[i]) * s + c0_[i];
+        derivative =
+            ((3.0 * c3_[i] * s + 2.0 * c2_[i]) * s + c1_[i]) * inv_width_[i];
+    }
+
+    void PiecewiseCubic::evaluate(const double* x,
+                                  double*       value,
+                                  double*       derivative,
+                                  size_t        n) const
+    {
+        // Gather the interval coefficients for a batch, then run Horner on
+        // the whole batch with Eigen's vectorized array operations.
+        Batch s, w, a0, a1, a2, a3;
+        for (size_t begin = 0; begin < n; begin += batch_size)
+        {
+            size_t m = std::min(batch_size, n - begin);
+            for (size_t k = 0; k < m; ++k)
+            {
+                double xk = x[begin + k];
+                size_t i  = find_interval(xk);
+                s[k]      = (xk - breaks_[i]) * inv_width_[i];
+                w[k]      = inv_width_[i];
+                a0[k]     = c0_[i];
+                a1[k]     = c1_[i];
+                a2[k]     = c2_[i];
+                a3[k]     = c3_[i];
+            }
+
+            auto sk = s.head(m);
+            Eigen::Map<Eigen::ArrayXd>(value + begin, m) =
+                ((a3.head(m) * sk + a2.head(m)) * sk + a1.head(m)) * sk +
+                a0.head(m);
+            if (derivative)
+            {
+                Eigen::Map<Eigen::ArrayXd>(derivative + begin, m) =
+                    ((3.0 * a3.head(m) * sk + 2.0 * a2.head(m)) * sk +
+                     a1.head(m)) *
+                    w.head(m);
+            }
+        }
+    }
+
+}  // namespace aero_model
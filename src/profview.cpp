@@ -0,0 +1,327 @@
+// utils_profview: live view of the ScopeProfiler statistics a process
+// exports with `ScopeProfiler::exportToSharedMemory()`.
+//
+//   utils_profview [-n seconds] [--once] [--threads] [segment]
+//
+// The segment is only mapped read-only, so the viewer can never stall the
+// profiled process. Without --once the viewer waits for the segment to
+// appear, so it can be started first and survives restarts of the process.
+#include <ScopeProfiler/ScopeProfiler.hpp>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::string name{ScopeProfiler::defaultSharedName};
+        double      interval_s{1.0};
+        bool        once{false};
+        bool        per_thread{false};
+    };
+
+    struct Row
+    {
+        std::string key;
+        std::string tag;
+        uint64_t    thread{0};
+        uint64_t    count{0};
+        uint64_t    total_us{0};
+        int64_t     min_us{0};
+        int64_t     max_us{0};
+        int64_t     last_us{0};
+        double      rate{0.0};
+    };
+
+    struct Sample
+    {
+        int32_t          pid{0};
+        uint32_t         capacity{0};
+        uint32_t         claimed{0};
+        std::vector<Row> rows;
+    };
+
+    void print_usage(const char* program)
+    {
+        std::cout << "Usage: " << program
+                  << " [-n seconds] [--once] [--threads] [segment]\n"
+                  << "  -n seconds  refresh interval (default 1)\n"
+                  << "  --once      print one sample and exit\n"
+                  << "  --threads   one row per thread and tag\n"
+                  << "  segment     shared memory name (default "
+                  << ScopeProfiler::defaultSharedName << ")\n";
+    }
+
+    bool parse_options(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "-n" && i + 1 < argc)
+            {
+                options.interval_s = std::atof(argv[++i]);
+            }
+            else if (arg == "--once")
+            {
+                options.once = true;
+            }
+            else if (arg == "--threads")
+            {
+                options.per_thread = true;
+            }
+            else if (!arg.empty() && arg[0] != '-')
+            {
+                options.name = arg;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return options.interval_s > 0.0;
+    }
+
+    // Attaches, copies every slot and detaches again, so a restarted
+    // process is picked up on the next refresh. On failure `error` says
+    // why; while a process restarts, the segment is briefly missing or not
+    // initialized.
+    bool read_sample(const Options& options, Sample& sample,
+                     std::string& error)
+    {
+        int fd = shm_open(options.name.c_str(), O_RDONLY, 0);
+        if (fd < 0)
+        {
+            error = std::string("cannot open: ") + std::strerror(errno);
+            return false;
+        }
+
+        struct stat info;
+        void*       memory = MAP_FAILED;
+        size_t      size   = 0;
+        if (fstat(fd, &info) == 0 &&
+            static_cast<size_t>(info.st_size) >=
+                sizeof(ScopeProfiler::SharedHeader))
+        {
+            size   = static_cast<size_t>(info.st_size);
+            memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (memory == MAP_FAILED)
+        {
+            error = "cannot map (still being created?)";
+            return false;
+        }
+
+        const auto* header =
+            static_cast<const ScopeProfiler::SharedHeader*>(memory);
+        bool valid =
+            header->magic.load(std::memory_order_acquire) ==
+                ScopeProfiler::sharedMagic &&
+            header->version == ScopeProfiler::sharedVersion &&
+            ScopeProfiler::sharedSize(header->capacity) <= size;
+        if (!valid)
+        {
+            error = "not a ScopeProfiler segment (or still being initialized)";
+            munmap(memory, size);
+            return false;
+        }
+
+        sample.pid      = header->pid;
+        sample.capacity = header->capacity;
+        sample.claimed  = header->claimed.load(std::memory_order_relaxed);
+        sample.rows.clear();
+
+        // Merge the per-thread slots of a tag unless --threads is given
+        std::map<std::string, Row> rows;
+        uint32_t used = std::min(sample.claimed, sample.capacity);
+        for (uint32_t i = 0; i < used; ++i)
+        {
+            ScopeProfiler::SharedStatistic stat;
+            if (!ScopeProfiler::readSharedSlot(header->slots()[i], stat) ||
+                stat.count == 0)
+            {
+                continue;
+            }
+
+            std::string key = stat.tag;
+            if (options.per_thread)
+            {
+                key = std::to_string(stat.thread) + ' ' + key;
+            }
+            Row& row = rows[key];
+            if (row.count == 0)
+            {
+                row.key    = key;
+                row.tag    = stat.tag;
+                row.thread = stat.thread;
+                row.min_us = stat.min_us;
+                row.max_us = stat.max_us;
+            }
+            row.count += stat.count;
+            row.total_us += stat.total_us;
+            row.min_us  = std::min(row.min_us, stat.min_us);
+            row.max_us  = std::max(row.max_us, stat.max_us);
+            row.last_us = stat.last_us;
+        }
+        munmap(memory, size);
+
+        for (auto& [key, row] : rows)
+        {
+            sample.rows.push_back(std::move(row));
+        }
+        return true;
+    }
+
+    // Same compact format as ScopeProfiler::printLog
+    std::string compact(uint64_t value, int width)
+    {
+        uint64_t limit = 1;
+        for (int i = 0; i < width - 1; ++i)
+        {
+            limit *= 10;
+        }
+
+        std::ostringstream out;
+        if (value > limit)
+        {
+            if (value / 1000 > limit / 10)
+            {
+                out << std::setw(width - 1) << value / 1000000 << 'M';
+            }
+            else
+            {
+                out << std::setw(width - 1) << value / 1000 << 'k';
+            }
+        }
+        else
+        {
+            out << std::setw(width) << value;
+        }
+        return out.str();
+    }
+
+    void print_sample(const Options& options, const Sample& sample)
+    {
+        bool alive = kill(sample.pid, 0) == 0 || errno == EPERM;
+        std::cout << "pid " << sample.pid << (alive ? "" : " (exited)")
+                  << "  slots " << std::min(sample.claimed, sample.capacity)
+                  << "/" << sample.capacity;
+        if (sample.claimed > sample.capacity)
+        {
+            std::cout << "  (" << sample.claimed - sample.capacity
+                      << " dropped)";
+        }
+        std::cout << "\n\n";
+
+        std::vector<const Row*> sorted;
+        for (const auto& row : sample.rows)
+        {
+            sorted.push_back(&row);
+        }
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const Row* lhs, const Row* rhs)
+                  { return lhs->total_us > rhs->total_us; });
+
+        std::cout << "   avg   |   min   |   max   |  last   |  total  |"
+                  << "  cnt  | rate/s |"
+                  << (options.per_thread ? "   tid   |" : "") << " tag\n";
+        for (const Row* row : sorted)
+        {
+            std::cout << compact(row->total_us / row->count, 9) << '|'
+                      << compact(row->min_us, 9) << '|'
+                      << compact(row->max_us, 9) << '|'
+                      << compact(row->last_us, 9) << '|'
+                      << compact(row->total_us, 9) << '|'
+                      << compact(row->count, 7) << '|'
+                      << compact(static_cast<uint64_t>(row->rate), 8) << '|';
+            if (options.per_thread)
+            {
+                std::cout << std::setw(9) << row->thread << '|';
+            }
+            std::cout << ' ' << row->tag << '\n';
+        }
+        std::cout << std::flush;
+    }
+}  // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options))
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::map<std::string, uint64_t> previous_counts;
+    int32_t                         previous_pid  = 0;
+    auto previous_time = std::chrono::steady_clock::now();
+    for (;;)
+    {
+        Sample      sample;
+        std::string error;
+        if (!read_sample(options, sample, error))
+        {
+            if (options.once)
+            {
+                std::cerr << "Error: Shared memory " << options.name << ": "
+                          << error << std::endl;
+                return 1;
+            }
+
+            // Keep polling; the exporting process may not be up yet
+            std::cout << "\033[H\033[2J"
+                      << "waiting for " << options.name << " (" << error
+                      << ")" << std::endl;
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>(options.interval_s));
+            continue;
+        }
+
+        // Calls per second since the previous refresh of the same process
+        if (sample.pid != previous_pid)
+        {
+            previous_counts.clear();
+            previous_pid = sample.pid;
+        }
+        auto   now     = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - previous_time)
+                             .count();
+        previous_time  = now;
+        for (auto& row : sample.rows)
+        {
+            auto found = previous_counts.find(row.key);
+            if (found != previous_counts.end() && elapsed > 0.0 &&
+                row.count >= found->second)
+            {
+                row.rate = (row.count - found->second) / elapsed;
+            }
+            previous_counts[row.key] = row.count;
+        }
+
+        if (options.once)
+        {
+            print_sample(options, sample);
+            return 0;
+        }
+
+        std::cout << "\033[H\033[2J";
+        print_sample(options, sample);
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(options.interval_s));
+    }
+}
@@ -0,0 +1,93 @@
+#include <cerrno>
+#include <cstdlib>  // For std::strtod
+#include <iostream>
+#include <sq_config_reader/schema_config_reader.hpp>
+
+namespace sq_config_reader
+{
+    namespace schema
+    {
+        namespace
+        {
+            // Parses the CSV item starting at `cursor`, mirroring
+            // `SQLiteConfigReader::parse_csv`: a malformed item is reported
+            // and skipped. Returns false when the item yields no value, and
+            // leaves `cursor` at the start of the next item (or at the end).
+            bool parse_item(const char*& cursor, double& value)
+            {
+                const char* item_end = cursor;
+                while (*item_end && *item_end != ',')
+                {
+                    ++item_end;
+                }
+
+                char* parsed_end = nullptr;
+                errno            = 0;
+                value            = std::strtod(cursor, &parsed_end);
+
+                bool ok = true;
+                if (parsed_end == cursor || parsed_end > item_end)
+                {
+                    std::cerr << "Invalid argument in CSV data: "
+                              << std::string_view(cursor, item_end - cursor)
+                              << std::endl;
+                    ok = false;
+                }
+                else if (errno == ERANGE)
+                {
+                    std::cerr << "Out of range value in CSV data: "
+                              << std::string_view(cursor, item_end - cursor)
+                              << std::endl;
+                    ok = false;
+                }
+
+                cursor = *item_end ? item_end + 1 : item_end;
+                return ok;
+            }
+        }  // anonymous namespace
+
+        bool decode(std::string_view column, const char* text, double& value)
+        {
+            const char* cursor = text;
+            while (*cursor)
+            {
+                if (parse_item(cursor, value))
+                {
+                    return true;
+                }
+            }
+
+            std::cerr << "Error: " << column << " is empty after parsing."
+                      << std::endl;
+            return false;
+        }
+
+        bool decode(std::string_view     column,
+                    const char*          text,
+                    std::vector<double>& values)
+        {
+            (void)column;
+
+            size_t items = 1;
+            for (const char* c = text; *c; ++c)
+            {
+                items += (*c == ',');
+            }
+
+            values.clear();
+            values.reserve(items);
+
+            const char* cursor = text;
+            double      value;
+            while (*cursor)
+            {
+                if (parse_item(cursor, value))
+                {
+                    values.push_back(value);
+                }
+            }
+            return true;
+        }
+    }  // namespace schema
+
+}  // namespace sq_config_reader
@@ -58,31 +58,65 @@ namespace sq_config_reader
         }
     }
 
-    SQLiteConfigReader::~SQLiteConfigReader()
+    SQLiteConfigReader::~SQLiteConfigReader() { disconnect(); }
+
+    bool SQLiteConfigReader::connect()
     {
-        if (stmt)
-        {
-            sqlite3_finalize(stmt);
-        }
+        // Reuse the open connection across loads
         if (db)
         {
-            sqlite3_close(db);
+            return true;
         }
-    }
 
-    bool SQLiteConfigReader::connect()
-    {
-        if (sqlite3_open(db_file.c_str(), &db) != SQLITE_OK)
+        // Readers only ever read, and a reader is used by one thread at a
+        // time, so the connection needs neither write access nor a mutex.
+        if (sqlite3_open_v2(db_file.c_str(), &db,
+                            SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+                            nullptr) != SQLITE_OK)
         {
             std::cerr << "Can't open database: " << sqlite3_errmsg(db)
                       << std::endl;
+            sqlite3_close(db);
+            db = nullptr;
             return false;
         }
         return true;
     }
 
+    void SQLiteConfigReader::disconnect()
+    {
+        if (stmt)
+        {
+            sqlite3_finalize(stmt);
+            stmt = nullptr;
+        }
+        if (db)
+        {
+            sqlite3_close(db);
+            db = nullptr;
+        }
+    }
+
     bool SQLiteConfigReader::access_and_fetch_data(int id)
     {
+        // Use the binary snapshot if it is still valid for this database
+        if (snapshot_cache_enabled)
+        {
+            ConfigSnapshot snapshot;
+            if (snapshot.open(db_file, table_name, id) &&
+                restore_snapshot(snapshot.fields()))
+            {
+                return true;
+            }
+        }
+
+        // Keying hashes the whole database, so skip it when no snapshot
+        // could be written anyway
+        DatabaseKey key_before;
+        bool        keyed = snapshot_cache_enabled &&
+                     ConfigSnapshot::can_write(db_file) &&
+                     ConfigSnapshot::read_database_key(db_file, key_before);
+
         // Try to connect to database
         if (!connect())
         {
@@ -97,14 +131,69 @@ namespace sq_config_reader
             return false;
         }
 
-        // Fetch data from database
-        if (!fetch_data())
+        // Fetch data from database. Resetting the statement ends its read
+        // transaction, so the kept connection does not block writers.
+        bool fetched = fetch_data();
+        sqlite3_reset(stmt);
+        if (!fetched)
         {
             std::cerr << "Failed to fetch data from database" << std::endl;
             return false;
         }
 
+        // Only cache what was read from an unchanged database
+        DatabaseKey key_after;
+        if (keyed && ConfigSnapshot::read_database_key(db_file, key_after) &&
+            key_after == key_before)
+        {
+            std::vector<SnapshotField> fields = snapshot_fields();
+            if (!fields.empty())
+            {
+                ConfigSnapshot::write(db_file, table_name, id, key_before,
+                                      fields);
+            }
+        }
+
         return true;
     }
 
-}  // namespace sq_config_reader
+    bool SQLiteConfigReader::fetch_ids(std::vector<int>& ids)
+    {
+        ids.clear();
+        if (!connect())
+        {
+            std::cerr << "Failed to connect to database" << std::endl;
+            return false;
+        }
+
+        std::string   sql = "SELECT id FROM " + table_name + " ORDER BY id";
+        sqlite3_stmt* ids_stmt = nullptr;
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &ids_stmt, nullptr) !=
+            SQLITE_OK)
+        {
+            std::cerr << "Failed to prepare statement: " << sqlite3_errmsg(db)
+                      << std::endl;
+            return false;
+        }
+
+        int rc;
+        while ((rc = sqlite3_step(ids_stmt)) == SQLITE_ROW)
+        {
+            ids.push_back(sqlite3_column_int(ids_stmt, 0));
+        }
+        if (rc != SQLITE_DONE)
+        {
+            std::cerr << "Error executing query: " << sqlite3_errmsg(db)
+                      << std::endl;
+        }
+        sqlite3_finalize(ids_stmt);
+        return rc == SQLITE_DONE;
+    }
+
+    std::future<bool> SQLiteConfigReader::access_and_fetch_data_async(int id)
+    {
+        return std::async(std::launch::async,
+                          [this, id]() { return access_and_fetch_data(id); });
+    }
+
+}  // namespace sq_config_reader
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <sq_config_reader/thread_pool.hpp>
+
+namespace sq_config_reader
+{
+    namespace
+    {
+        thread_local const ThreadPool* current_pool   = nullptr;
+        thread_local size_t            current_worker = ThreadPool::no_worker;
+    }  // anonymous namespace
+
+    ThreadPool::ThreadPool(size_t thread_count)
+    {
+        if (thread_count == 0)
+        {
+            thread_count = 1;
+        }
+
+        // All queues exist before any worker may steal from them
+        queues_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        workers_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            workers_.emplace_back(&ThreadPool::run, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+
+        for (auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadPool::worker_index() const
+    {
+        return current_pool == this ? current_worker : no_worker;
+    }
+
+    void ThreadPool::enqueue(std::function<void()> task)
+    {
+        size_t index = worker_index();
+        if (index == no_worker)
+        {
+            index = next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                    queues_.size();
+        }
+
+        // Counted before it becomes visible, so a worker that takes the task
+        // never sees the count go below zero.
+        pending_.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+
+        // Taking the lock orders this against a worker that has just seen
+        // no pending work and is about to sleep.
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+        }
+        cv_.notify_one();
+    }
+
+    bool ThreadPool::try_pop(size_t index, std::function<void()>& task)
+    {
+        WorkerQueue&                queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+        {
+            return false;
+        }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+
+    bool ThreadPool::try_steal(size_t index, std::function<void()>& task)
+    {
+        for (size_t k = 1; k < queues_.size(); ++k)
+        {
+            WorkerQueue& victim = *queues_[(index + k) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.back());
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ThreadPool::run(size_t index)
+    {
+        current_pool   = this;
+        current_worker = index;
+
+        for (;;)
+        {
+            std::function<void()> task;
+            if (try_pop(index, task) || try_steal(index, task))
+            {
+                pending_.fetch_sub(1);
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stopping_ || pending_ > 0; });
+            if (stopping_ && pending_ == 0)
+            {
+                return;
+            }
+        }
+    }
+
+}  // namespace sq_config_reader
@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+
+#include <aero_model/bspline_aero_model.hpp>
+#include <aero_model/piecewise_cubic.hpp>
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <vector>
+
+namespace
+{
+    constexpr int degree = 3;
+
+    // The repeated knot of the non-uniform curve leaves it only C1 there, so
+    // a central difference is first-order accurate at that knot (error about
+    // step times the jump in the second derivative); the step is kept small.
+    constexpr double step                = 1e-7;
+    constexpr double value_tolerance     = 1e-12;
+    constexpr double reference_tolerance = 1e-9;  // Derivative vs de Boor
+    constexpr double central_tolerance   = 1e-6;  // Derivative vs differences
+
+    struct Curve
+    {
+        const char*         name;
+        std::vector<double> knots;
+        std::vector<double> coefs;
+        bool                uniform;
+    };
+
+    void PrintTo(const Curve& curve, std::ostream* os)
+    {
+        *os << curve.name;
+    }
+
+    // Clamped uniform knots take the O(1) interval lookup; the non-uniform
+    // vector (with a repeated interior knot, i.e. an empty interval) takes
+    // the binary search.
+    Curve clamped_uniform()
+    {
+        return {"ClampedUniform",
+                {0.0, 0.0, 0.0, 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 5.0, 5.0, 5.0},
+                {0.2, -0.4, 1.1, 0.7, -0.3, 0.5, 1.6, -0.8},
+                true};
+    }
+
+    Curve non_uniform()
+    {
+        return {"NonUniform",
+                {-1.0, -1.0, -1.0, -1.0, -0.4, -0.05, 0.1, 0.1, 0.6, 1.5,
+                 1.5, 1.5, 1.5},
+                {0.05, 0.3, -0.2, 0.9, 1.2, 0.4, -0.6, 0.1, 0.8},
+                false};
+    }
+
+    // Cox-de Boor basis function N_{i,p}(x) on half-open knot intervals
+    double basis(const std::vector<double>& t, size_t i, int p, double x)
+    {
+        if (p == 0)
+        {
+            return (t[i] <= x && x < t[i + 1]) ? 1.0 : 0.0;
+        }
+        double result = 0.0;
+        if (t[i + p] > t[i])
+        {
+            result += (x - t[i]) / (t[i + p] - t[i]) * basis(t, i, p - 1, x);
+        }
+        if (t[i + p + 1] > t[i + 1])
+        {
+            result += (t[i + p + 1] - x) / (t[i + p + 1] - t[i + 1]) *
+                      basis(t, i + 1, p - 1, x);
+        }
+        return result;
+    }
+
+    // Reference value and derivative for x in [knots[3], knots[n]), from
+    // the basis functions and their derivative formula
+    void reference(const Curve& curve, double x, double& value,
+                   double& derivative)
+    {
+        const auto& t = curve.knots;
+        value         = 0.0;
+        derivative    = 0.0;
+        for (size_t i = 0; i < curve.coefs.size(); ++i)
+        {
+            value += curve.coefs[i] * basis(t, i, degree, x);
+
+            double slope = 0.0;
+            if (t[i + degree] > t[i])
+            {
+                slope += degree / (t[i + degree] - t[i]) *
+                         basis(t, i, degree - 1, x);
+            }
+            if (t[i + degree + 1] > t[i + 1])
+            {
+                slope -= degree / (t[i + degree + 1] - t[i + 1]) *
+                         basis(t, i + 1, degree - 1, x);
+            }
+            derivative += curve.coefs[i] * slope;
+        }
+    }
+
+    // Uniform sweep of [lower, upper) plus every knot and its neighbours
+    std::vector<double> inside_samples(const Curve& curve)
+    {
+        double lower = curve.knots[degree];
+        double upper = curve.knots[curve.coefs.size()];
+
+        std::vector<double> xs;
+        for (int i = 0; i < 1000; ++i)
+        {
+            xs.push_back(lower + (upper - lower) * i / 1000.0);
+        }
+        for (double knot : curve.knots)
+        {
+            for (double offset : {-1e-9, 0.0, 1e-9})
+            {
+                double x = knot + offset;
+                if (x >= lower && x < upper)
+                {
+                    xs.push_back(x);
+                }
+            }
+        }
+        return xs;
+    }
+
+    // Also covers the extrapolated end polynomials
+    std::vector<double> all_samples(const Curve& curve)
+    {
+        double lower = curve.knots[degree];
+        double upper = curve.knots[curve.coefs.size()];
+        double width = upper - lower;
+
+        std::vector<double> xs = inside_samples(curve);
+        for (int i = 0; i <= 20; ++i)
+        {
+            xs.push_back(lower - 0.5 * width * i / 20.0);
+            xs.push_back(upper + 0.5 * width * i / 20.0);
+        }
+        return xs;
+    }
+
+    void expect_close(double actual, double expected, double tolerance,
+                      const char* what, double x)
+    {
+        double scale = std::max(1.0, std::abs(expected));
+        EXPECT_LE(std::abs(actual - expected) / scale, tolerance)
+            << what << " at x = " << x << ": got " << actual << ", expected "
+            << expected;
+    }
+
+    class PiecewiseCubicTest : public ::testing::TestWithParam<Curve>
+    {
+       protected:
+        void SetUp() override
+        {
+            ASSERT_TRUE(cubic.build(GetParam().knots, GetParam().coefs));
+            ASSERT_EQ(cubic.is_uniform(), GetParam().uniform);
+        }
+
+        aero_model::PiecewiseCubic cubic;
+    };
+}  // anonymous namespace
+
+TEST_P(PiecewiseCubicTest, ScalarMatchesDeBoor)
+{
+    for (double x : inside_samples(GetParam()))
+    {
+        double value_ref, derivative_ref;
+        reference(GetParam(), x, value_ref, derivative_ref);
+
+        double value, derivative;
+        cubic.value_and_derivative(x, value, derivative);
+        expect_close(value, value_ref, value_tolerance, "value", x);
+        expect_close(cubic.value(x), value_ref, value_tolerance, "value()",
+                     x);
+        expect_close(derivative, derivative_ref, reference_tolerance,
+                     "derivative", x);
+    }
+}
+
+TEST_P(PiecewiseCubicTest, DerivativeMatchesCentralDifferences)
+{
+    for (double x : all_samples(GetParam()))
+    {
+        double value, derivative;
+        cubic.value_and_derivative(x, value, derivative);
+        double numerical =
+            (cubic.value(x + step) - cubic.value(x - step)) / (2 * step);
+        expect_close(derivative, numerical, central_tolerance, "derivative",
+                     x);
+    }
+}
+
+TEST_P(PiecewiseCubicTest, BatchMatchesScalar)
+{
+    // Not a multiple of the 64-point batch, so the tail is covered too
+    std::vector<double> xs = all_samples(GetParam());
+    ASSERT_NE(xs.size() % 64, 0u);
+
+    size_t              n = xs.size();
+    std::vector<double> values(n), derivatives(n), values_only(n);
+    cubic.evaluate(xs.data(), values.data(), derivatives.data(), n);
+    cubic.evaluate(xs.data(), values_only.data(), nullptr, n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        double value, derivative;
+        cubic.value_and_derivative(xs[i], value, derivative);
+        expect_close(values[i], value, value_tolerance, "batch value", xs[i]);
+        expect_close(values_only[i], value, value_tolerance,
+                     "batch value without derivative", xs[i]);
+        expect_close(derivatives[i], derivative, value_tolerance,
+                     "batch derivative", xs[i]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Knots, PiecewiseCubicTest,
+                         ::testing::Values(clamped_uniform(), non_uniform()),
+                         [](const auto& info) { return info.param.name; });
+
+TEST(BSplineAeroModelTest, MatchesDeBoorAndCentralDifferences)
+{
+    Curve cx = clamped_uniform();
+    Curve cz = non_uniform();
+
+    sq_config_reader::BSplineAeroConfig config;
+    config.cx_knots     = cx.knots;
+    config.cx_coefs     = cx.coefs;
+    config.cz_knots     = cz.knots;
+    config.cz_coefs     = cz.coefs;
+    config.scale_factor = 0.5;
+
+    aero_model::BSplineAeroModel model;
+    ASSERT_TRUE(model.build(config));
+    EXPECT_EQ(model.scale_factor(), 0.5);
+
+    // Both curves are sampled at the same angles, so take the overlap of
+    // their domains for the de Boor check
+    std::vector<double> alphas;
+    for (int i = 0; i < 1000; ++i)
+    {
+        alphas.push_back(-1.0 + 2.5 * i / 1000.0);
+    }
+
+    size_t              n = alphas.size();
+    std::vector<double> cx_batch(n), cz_batch(n), dcx_batch(n), dcz_batch(n);
+    model.evaluate(alphas.data(), cx_batch.data(), cz_batch.data(),
+                   dcx_batch.data(), dcz_batch.data(), n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        double alpha  = alphas[i];
+        auto   result = model.evaluate(alpha);
+
+        double value_ref, derivative_ref;
+        if (alpha >= 0.0 && alpha < 5.0)
+        {
+            reference(cx, alpha, value_ref, derivative_ref);
+            expect_close(result.cx, value_ref, value_tolerance, "cx", alpha);
+            expect_close(result.dcx_dalpha, derivative_ref,
+                         reference_tolerance, "dcx/dalpha", alpha);
+        }
+        if (alpha < 1.5)
+        {
+            reference(cz, alpha, value_ref, derivative_ref);
+            expect_close(result.cz, value_ref, value_tolerance, "cz", alpha);
+            expect_close(result.dcz_dalpha, derivative_ref,
+                         reference_tolerance, "dcz/dalpha", alpha);
+        }
+
+        auto plus  = model.evaluate(alpha + step);
+        auto minus = model.evaluate(alpha - step);
+        expect_close(result.dcx_dalpha, (plus.cx - minus.cx) / (2 * step),
+                     central_tolerance, "dcx/dalpha (differences)", alpha);
+        expect_close(result.dcz_dalpha, (plus.cz - minus.cz) / (2 * step),
+                     central_tolerance, "dcz/dalpha (differences)", alpha);
+
+        expect_close(cx_batch[i], result.cx, value_tolerance, "batch cx",
+                     alpha);
+        expect_close(cz_batch[i], result.cz, value_tolerance, "batch cz",
+                     alpha);
+        expect_close(dcx_batch[i], result.dcx_dalpha, value_tolerance,
+                     "batch dcx/dalpha", alpha);
+        expect_close(dcz_batch[i], result.dcz_dalpha, value_tolerance,
+                     "batch dcz/dalpha", alpha);
+    }
+}
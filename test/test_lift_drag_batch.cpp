@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <aero_model/lift_drag_aero_model.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr double pi        = 3.14159265358979323846;
+    constexpr double tolerance = aero_model::LiftDragAeroModel::batch_tolerance;
+
+    // Not a multiple of the 64-point batch, so the tail is covered too
+    constexpr size_t sample_count = 4001;
+
+    sq_config_reader::AdvancedLiftDragConfig make_config(double blend)
+    {
+        sq_config_reader::AdvancedLiftDragConfig config{};
+        config.sigmoid_blend = blend;
+        config.cl_alpha_0    = 0.3;
+        config.cl_alpha      = 4.7;
+        config.alpha_stall   = 0.3;
+        config.eff           = 6.0;
+        config.cd_0          = 0.02;
+        config.cd_flat_plate = 1.2;
+        config.cy_beta       = -0.3;
+        config.cl_beta_loss  = 0.5;
+        config.scale_factor  = 0.6;
+        return config;
+    }
+
+    struct Inputs
+    {
+        std::vector<double> alpha;
+        std::vector<double> beta;
+        std::vector<double> airspeed;
+    };
+
+    // Random points over the full alpha range, with the stall angles and
+    // alpha = 0 mixed in, where the sharp blends switch branches
+    Inputs make_inputs(double alpha_stall)
+    {
+        std::mt19937                           rng(7);
+        std::uniform_real_distribution<double> alpha(-pi, pi);
+        std::uniform_real_distribution<double> beta(-1.5, 1.5);
+        std::uniform_real_distribution<double> airspeed(0.0, 40.0);
+
+        Inputs inputs;
+        for (size_t i = 0; i < sample_count; ++i)
+        {
+            double a = alpha(rng);
+            if (i % 10 == 0)
+            {
+                double kinks[] = {0.0, alpha_stall, -alpha_stall};
+                a = kinks[(i / 10) % 3] + 1e-4 * (a / pi);
+            }
+            inputs.alpha.push_back(a);
+            inputs.beta.push_back(beta(rng));
+            inputs.airspeed.push_back(airspeed(rng));
+        }
+        return inputs;
+    }
+
+    void expect_close(double batch, double reference, const char* what,
+                      const Inputs& inputs, size_t i)
+    {
+        double scale = std::max(1.0, std::abs(reference));
+        EXPECT_LE(std::abs(batch - reference) / scale, tolerance)
+            << what << " at alpha = " << inputs.alpha[i]
+            << ", beta = " << inputs.beta[i]
+            << ", airspeed = " << inputs.airspeed[i] << ": batch " << batch
+            << ", scalar " << reference;
+    }
+
+    class LiftDragBatchTest : public ::testing::TestWithParam<double>
+    {
+       protected:
+        void SetUp() override
+        {
+            ASSERT_TRUE(model.build(make_config(GetParam())));
+        }
+
+        aero_model::LiftDragAeroModel model;
+    };
+}  // anonymous namespace
+
+TEST_P(LiftDragBatchTest, MatchesScalarReference)
+{
+    Inputs inputs = make_inputs(model.config().alpha_stall);
+    size_t n      = inputs.alpha.size();
+    ASSERT_NE(n % 64, 0u);
+
+    std::vector<double> cl(n), cd(n), cy(n), lift(n), drag(n), side(n);
+
+    aero_model::LiftDragBatch batch;
+    batch.alpha    = inputs.alpha.data();
+    batch.beta     = inputs.beta.data();
+    batch.airspeed = inputs.airspeed.data();
+    batch.cl       = cl.data();
+    batch.cd       = cd.data();
+    batch.cy       = cy.data();
+    batch.lift     = lift.data();
+    batch.drag     = drag.data();
+    batch.side     = side.data();
+    model.evaluate(batch, n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto   reference = model.evaluate(inputs.alpha[i], inputs.beta[i]);
+        double q         = model.force_scale(inputs.airspeed[i]);
+
+        expect_close(cl[i], reference.cl, "cl", inputs, i);
+        expect_close(cd[i], reference.cd, "cd", inputs, i);
+        expect_close(cy[i], reference.cy, "cy", inputs, i);
+        expect_close(lift[i], reference.cl * q, "lift", inputs, i);
+        expect_close(drag[i], reference.cd * q, "drag", inputs, i);
+        expect_close(side[i], reference.cy * q, "side", inputs, i);
+    }
+}
+
+TEST_P(LiftDragBatchTest, ForcesOnlyMatchScalarReference)
+{
+    Inputs inputs = make_inputs(model.config().alpha_stall);
+    size_t n      = inputs.alpha.size();
+
+    std::vector<double> lift(n), drag(n), side(n);
+
+    aero_model::LiftDragBatch batch;
+    batch.alpha    = inputs.alpha.data();
+    batch.beta     = inputs.beta.data();
+    batch.airspeed = inputs.airspeed.data();
+    batch.lift     = lift.data();
+    batch.drag     = drag.data();
+    batch.side     = side.data();
+    model.evaluate(batch, n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto   reference = model.evaluate(inputs.alpha[i], inputs.beta[i]);
+        double q         = model.force_scale(inputs.airspeed[i]);
+
+        expect_close(lift[i], reference.cl * q, "lift", inputs, i);
+        expect_close(drag[i], reference.cd * q, "drag", inputs, i);
+        expect_close(side[i], reference.cy * q, "side", inputs, i);
+    }
+}
+
+// Default blend, a sharper stall and a near-step transition, where the
+// naive exp(x) / exp(x) form of the blend would overflow
+INSTANTIATE_TEST_SUITE_P(SigmoidBlend, LiftDragBatchTest,
+                         ::testing::Values(15.0, 50.0, 1e4));
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <aero_model/lift_drag_aero_model.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr double pi = 3.14159265358979323846;
+
+    // CL has a second-derivative jump wherever |sin(alpha)| has its kink
+    // (alpha = 0, +-pi). There a central difference is only first-order
+    // accurate, with an error of about 2 * step, so the step is kept small.
+    constexpr double step      = 1e-7;
+    constexpr double tolerance = 1e-6;  // Relative to max(1, |derivative|)
+
+    sq_config_reader::AdvancedLiftDragConfig make_config(double blend)
+    {
+        sq_config_reader::AdvancedLiftDragConfig config{};
+        config.sigmoid_blend = blend;
+        config.cl_alpha_0    = 0.3;
+        config.cl_alpha      = 4.7;
+        config.alpha_stall   = 0.3;
+        config.eff           = 6.0;
+        config.cd_0          = 0.02;
+        config.cd_flat_plate = 1.2;
+        config.cy_beta       = -0.3;
+        config.cl_beta_loss  = 0.5;
+        config.scale_factor  = 1.0;
+        return config;
+    }
+
+    // Uniform sweep plus the points where the model changes character: the
+    // stall angles and alpha = 0, where |sin(alpha)| has its kink.
+    std::vector<double> alpha_samples(double alpha_stall)
+    {
+        std::vector<double> alphas;
+        for (int i = 0; i <= 200; ++i)
+        {
+            alphas.push_back(-pi + 2.0 * pi * i / 200.0);
+        }
+        for (double offset : {-1e-3, 0.0, 1e-3})
+        {
+            alphas.push_back(offset);
+            alphas.push_back(alpha_stall + offset);
+            alphas.push_back(-alpha_stall + offset);
+        }
+        return alphas;
+    }
+
+    std::vector<double> beta_samples()
+    {
+        std::vector<double> betas;
+        for (int i = 0; i <= 20; ++i)
+        {
+            betas.push_back(-1.5 + 3.0 * i / 20.0);
+        }
+        return betas;
+    }
+
+    void expect_close(double analytical, double numerical, const char* what,
+                      double alpha, double beta)
+    {
+        double scale = std::max(1.0, std::abs(analytical));
+        EXPECT_LE(std::abs(analytical - numerical) / scale, tolerance)
+            << what << " at alpha = " << alpha << ", beta = " << beta
+            << ": analytical " << analytical << ", numerical " << numerical;
+    }
+
+    class LiftDragDerivativesTest : public ::testing::TestWithParam<double>
+    {
+       protected:
+        void SetUp() override
+        {
+            ASSERT_TRUE(model.build(make_config(GetParam())));
+        }
+
+        aero_model::LiftDragAeroModel model;
+    };
+}  // anonymous namespace
+
+TEST_P(LiftDragDerivativesTest, ScalarMatchesCentralDifferences)
+{
+    for (double alpha : alpha_samples(model.config().alpha_stall))
+    {
+        for (double beta : beta_samples())
+        {
+            auto d = model.evaluate_with_derivatives(alpha, beta);
+            auto v = model.evaluate(alpha, beta);
+            EXPECT_EQ(d.value.cl, v.cl);
+            EXPECT_EQ(d.value.cd, v.cd);
+            EXPECT_EQ(d.value.cy, v.cy);
+
+            auto ap = model.evaluate(alpha + step, beta);
+            auto am = model.evaluate(alpha - step, beta);
+            auto bp = model.evaluate(alpha, beta + step);
+            auto bm = model.evaluate(alpha, beta - step);
+
+            expect_close(d.d_alpha.cl, (ap.cl - am.cl) / (2 * step),
+                         "dCL/dalpha", alpha, beta);
+            expect_close(d.d_alpha.cd, (ap.cd - am.cd) / (2 * step),
+                         "dCD/dalpha", alpha, beta);
+            expect_close(d.d_alpha.cy, (ap.cy - am.cy) / (2 * step),
+                         "dCY/dalpha", alpha, beta);
+            expect_close(d.d_beta.cl, (bp.cl - bm.cl) / (2 * step),
+                         "dCL/dbeta", alpha, beta);
+            expect_close(d.d_beta.cd, (bp.cd - bm.cd) / (2 * step),
+                         "dCD/dbeta", alpha, beta);
+            expect_close(d.d_beta.cy, (bp.cy - bm.cy) / (2 * step),
+                         "dCY/dbeta", alpha, beta);
+        }
+    }
+}
+
+TEST_P(LiftDragDerivativesTest, BatchMatchesCentralDifferences)
+{
+    std::vector<double> alpha, beta;
+    for (double a : alpha_samples(model.config().alpha_stall))
+    {
+        for (double b : beta_samples())
+        {
+            alpha.push_back(a);
+            beta.push_back(b);
+        }
+    }
+
+    size_t              n = alpha.size();
+    std::vector<double> dcl_dalpha(n), dcl_dbeta(n), dcd_dalpha(n);
+
+    aero_model::LiftDragBatch batch;
+    batch.alpha      = alpha.data();
+    batch.beta       = beta.data();
+    batch.dcl_dalpha = dcl_dalpha.data();
+    batch.dcl_dbeta  = dcl_dbeta.data();
+    batch.dcd_dalpha = dcd_dalpha.data();
+    model.evaluate(batch, n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto ap = model.evaluate(alpha[i] + step, beta[i]);
+        auto am = model.evaluate(alpha[i] - step, beta[i]);
+        auto bp = model.evaluate(alpha[i], beta[i] + step);
+        auto bm = model.evaluate(alpha[i], beta[i] - step);
+
+        expect_close(dcl_dalpha[i], (ap.cl - am.cl) / (2 * step),
+                     "batch dCL/dalpha", alpha[i], beta[i]);
+        expect_close(dcd_dalpha[i], (ap.cd - am.cd) / (2 * step),
+                     "batch dCD/dalpha", alpha[i], beta[i]);
+        expect_close(dcl_dbeta[i], (bp.cl - bm.cl) / (2 * step),
+                     "batch dCL/dbeta", alpha[i], beta[i]);
+    }
+}
+
+TEST_P(LiftDragDerivativesTest, ForceScaleDerivativeMatchesCentralDifference)
+{
+    for (double airspeed : {0.0, 1.0, 12.5, 40.0})
+    {
+        double numerical = (model.force_scale(airspeed + step) -
+                            model.force_scale(airspeed - step)) /
+                           (2 * step);
+        expect_close(model.force_scale_derivative(airspeed), numerical,
+                     "d(force scale)/dV", airspeed, 0.0);
+    }
+}
+
+// Blend sharpness of the default config and a sharper stall transition
+INSTANTIATE_TEST_SUITE_P(SigmoidBlend, LiftDragDerivativesTest,
+                         ::testing::Values(15.0, 50.0));